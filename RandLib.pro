@@ -9,6 +9,9 @@ QMAKE_CXXFLAGS += -Wall -Wextra -Wshadow -Wnon-virtual-dtor -pedantic -Weffc++ -
 CONFIG += c++17
 QMAKE_CXXFLAGS += -std=c++17
 
+# Sample statistics of large samples are calculated by several threads
+CONFIG += thread
+
 DEFINES += RANDLIB_LIBRARY
 
 SOURCES += \
@@ -72,6 +75,7 @@ SOURCES += \
     math/BetaMath.cpp \
     math/GammaMath.cpp \
     math/NumericMath.cpp \
+    math/ParallelMath.cpp \
     distributions/univariate/continuous/MarchenkoPasturRand.cpp \
     distributions/bivariate/ContinuousBivariateDistribution.cpp \
     distributions/bivariate/DiscreteBivariateDistribution.cpp \
@@ -79,8 +83,20 @@ SOURCES += \
     distributions/bivariate/TrinomialRand.cpp \
     distributions/univariate/continuous/circular/CircularDistribution.cpp \
     distributions/univariate/UnivariateDistribution.cpp \
+    distributions/univariate/SampleMoments.cpp \
+    distributions/univariate/SufficientStatistics.cpp \
+    distributions/univariate/MaximumLikelihoodFitter.cpp \
+    distributions/univariate/Bootstrap.cpp \
+    distributions/univariate/MixtureRand.cpp \
     distributions/univariate/continuous/circular/WrappedExponentialRand.cpp \
-    distributions/univariate/continuous/FisherFRand.cpp
+    distributions/univariate/continuous/FisherFRand.cpp \
+    distributions/univariate/discrete/SparseBernoulliSampler.cpp \
+    distributions/univariate/discrete/GuideTableSampler.cpp \
+    distributions/univariate/continuous/InversionSampler.cpp \
+    distributions/univariate/continuous/LogConcaveSampler.cpp \
+    distributions/univariate/continuous/ZigguratSampler.cpp \
+    distributions/univariate/continuous/FourierDensity.cpp \
+    distributions/univariate/continuous/SumDistribution.cpp
 
 HEADERS +=\
     distributions/ProbabilityDistribution.h \
@@ -146,6 +162,7 @@ HEADERS +=\
     math/BetaMath.h \
     math/GammaMath.h \
     math/NumericMath.h \
+    math/ParallelMath.h \
     RandLib_global.h \
     distributions/univariate/continuous/MarchenkoPasturRand.h \
     distributions/bivariate/ContinuousBivariateDistribution.h \
@@ -154,8 +171,20 @@ HEADERS +=\
     distributions/bivariate/TrinomialRand.h \
     distributions/univariate/continuous/circular/CircularDistribution.h \
     distributions/univariate/UnivariateDistribution.h \
+    distributions/univariate/SampleMoments.h \
+    distributions/univariate/SufficientStatistics.h \
+    distributions/univariate/MaximumLikelihoodFitter.h \
+    distributions/univariate/Bootstrap.h \
+    distributions/univariate/MixtureRand.h \
     distributions/univariate/continuous/circular/WrappedExponentialRand.h \
-    distributions/univariate/continuous/FisherFRand.h
+    distributions/univariate/continuous/FisherFRand.h \
+    distributions/univariate/discrete/SparseBernoulliSampler.h \
+    distributions/univariate/discrete/GuideTableSampler.h \
+    distributions/univariate/continuous/InversionSampler.h \
+    distributions/univariate/continuous/LogConcaveSampler.h \
+    distributions/univariate/continuous/ZigguratSampler.h \
+    distributions/univariate/continuous/FourierDensity.h \
+    distributions/univariate/continuous/SumDistribution.h
 
 unix {
     target.path = /usr/lib
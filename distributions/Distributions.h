@@ -6,6 +6,7 @@
 
 /// UNIVARIATE
 #include "univariate/UnivariateDistribution.h"
+#include "univariate/Bootstrap.h"
 
 /// CONTINUOUS
 #include "univariate/continuous/ContinuousDistribution.h"
@@ -22,11 +23,13 @@
 #include "univariate/continuous/GumbelRand.h"
 #include "univariate/continuous/InverseGammaRand.h"
 #include "univariate/continuous/InverseGaussianRand.h"
+#include "univariate/continuous/InversionSampler.h"
 #include "univariate/continuous/IrwinHallRand.h"
 #include "univariate/continuous/KolmogorovSmirnovRand.h"
 #include "univariate/continuous/LaplaceRand.h"
 #include "univariate/continuous/LevyRand.h"
 #include "univariate/continuous/LogisticRand.h"
+#include "univariate/continuous/LogConcaveSampler.h"
 #include "univariate/continuous/LogNormalRand.h"
 #include "univariate/continuous/MarchenkoPasturRand.h"
 #include "univariate/continuous/NakagamiRand.h"
@@ -42,6 +45,9 @@
 #include "univariate/continuous/TriangularRand.h"
 #include "univariate/continuous/WeibullRand.h"
 #include "univariate/continuous/WignerSemicircleRand.h"
+#include "univariate/continuous/ZigguratSampler.h"
+#include "univariate/continuous/FourierDensity.h"
+#include "univariate/continuous/SumDistribution.h"
 
 /// CIRCULAR
 #include "univariate/continuous/circular/VonMisesRand.h"
@@ -54,6 +60,7 @@
 #include "univariate/discrete/BinomialRand.h"
 #include "univariate/discrete/CategoricalRand.h"
 #include "univariate/discrete/GeometricRand.h"
+#include "univariate/discrete/GuideTableSampler.h"
 #include "univariate/discrete/HyperGeometricRand.h"
 #include "univariate/discrete/NegativeBinomialRand.h"
 #include "univariate/discrete/NegativeHyperGeometricRand.h"
@@ -61,6 +68,7 @@
 #include "univariate/discrete/PoissonRand.h"
 #include "univariate/discrete/RademacherRand.h"
 #include "univariate/discrete/SkellamRand.h"
+#include "univariate/discrete/SparseBernoulliSampler.h"
 #include "univariate/discrete/UniformDiscreteRand.h"
 #include "univariate/discrete/YuleRand.h"
 #include "univariate/discrete/ZetaRand.h"
@@ -70,6 +78,9 @@
 #include "univariate/singular/SingularDistribution.h"
 #include "univariate/singular/CantorRand.h"
 
+/// MIXTURES
+#include "univariate/MixtureRand.h"
+
 /// BIVARIATE
 #include "bivariate/ContinuousBivariateDistribution.h"
 #include "bivariate/NormalInverseGammaRand.h"
@@ -111,6 +111,7 @@ protected:
     static constexpr char NON_NEGATIVITY_VIOLATION[] = "All elements should be non-negative";
     static constexpr char UPPER_LIMIT_VIOLATION[] = "No element should be bigger than ";
     static constexpr char LOWER_LIMIT_VIOLATION[] = "No element should be less than ";
+    static constexpr char MISSING_STATISTICS[] = "Required statistics are not accumulated";
 
     String fitErrorDescription(FIT_ERROR_TYPE fet, const String &explanation);
 };
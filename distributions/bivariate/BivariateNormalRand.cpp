@@ -81,7 +81,7 @@ double BivariateNormalRand::F(const DoublePair &point) const
     if (std::fabs(rho) < 1.0) {
         double lowLimit = std::asin(rho);
         double highLimit = RandMath::sign(rho) * M_PI_2;
-        p2 = RandMath::integral([this, xAdj, yAdj] (double theta) {
+        p2 = RandMath::integralAdaptiveSimpson([this, xAdj, yAdj] (double theta) {
             /// Integrand is exp(-(x^2 + y^2 - 2xysin(θ)) / (2cos(θ)^2))
             double cosTheta = std::cos(theta);
             double tanTheta = std::tan(theta);
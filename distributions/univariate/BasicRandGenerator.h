@@ -121,6 +121,19 @@ public:
     BasicRandGenerator() {}
 
     unsigned long long Variate() { return engine.Next(); }
+
+    /**
+     * @fn Variate64
+     * @return 64 random bits, two variates are concatenated for 32-bit engines
+     */
+    unsigned long long Variate64()
+    {
+        unsigned long long X = engine.Next();
+        if (engine.MaxValue() > 4294967295ULL)
+            return X;
+        return (X << 32) | engine.Next();
+    }
+
     size_t maxDecimals() { return getDecimals(engine.MaxValue()); }
     unsigned long long MaxValue() { return engine.MaxValue(); }
     void Reseed(unsigned long seed) { engine.Reseed(seed); }
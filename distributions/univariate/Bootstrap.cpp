@@ -0,0 +1,175 @@
+#include "Bootstrap.h"
+#include "continuous/NormalRand.h"
+#include "discrete/UniformDiscreteRand.h"
+#include "math/ParallelMath.h"
+
+template < typename T >
+Bootstrap<T>::Bootstrap(const Estimator &parametersEstimator, size_t replicatesCount, unsigned long randomSeed) :
+    estimator(parametersEstimator),
+    replicatesNumber(replicatesCount),
+    seed(randomSeed)
+{
+    if (!estimator)
+        throw std::invalid_argument("Bootstrap: estimator should be defined");
+    if (replicatesNumber < 2)
+        throw std::invalid_argument("Bootstrap: number of replicates should be at least 2");
+}
+
+template < typename T >
+void Bootstrap<T>::Run(const std::vector<T> &sample)
+{
+    size_t n = sample.size();
+    if (n == 0)
+        throw std::invalid_argument("Bootstrap: sample should be non-empty");
+    estimate = estimator(sample, std::vector<double>(n, 1.0));
+    size_t dimension = estimate.size();
+    if (dimension == 0)
+        throw std::invalid_argument("Bootstrap: estimator should return at least one parameter");
+
+    /// Multiplicities of indices, drawn with replacement, are accumulated in the buffer of weights
+    std::vector<std::vector<double>> values(dimension, std::vector<double>(replicatesNumber));
+    runTasks(replicatesNumber, n, [this, &sample, &values, n, dimension] (size_t index, std::vector<double> &weights)
+    {
+        RandGenerator generator;
+        generator.Reseed(substreamSeed(index));
+        std::fill(weights.begin(), weights.end(), 0.0);
+        for (size_t i = 0; i != n; ++i)
+            weights[UniformDiscreteRand::StandardVariate(n, generator)] += 1.0;
+        std::vector<double> parameters = estimator(sample, weights);
+        if (parameters.size() != dimension)
+            throw std::runtime_error("Bootstrap: estimator should return the same number of parameters for each replicate");
+        for (size_t j = 0; j != dimension; ++j)
+            values[j][index] = parameters[j];
+    });
+    replicates = std::move(values);
+    acceleration = jackknifeAcceleration(sample);
+}
+
+template < typename T >
+const std::vector<double> &Bootstrap<T>::GetReplicates(size_t index) const
+{
+    if (index >= replicates.size())
+        throw std::out_of_range("Bootstrap: index of parameter is out of range");
+    return replicates[index];
+}
+
+template < typename T >
+std::vector<double> Bootstrap<T>::StandardErrors() const
+{
+    checkRun(0.5);
+    std::vector<double> errors(replicates.size());
+    double correction = static_cast<double>(replicatesNumber) / (replicatesNumber - 1);
+    for (size_t j = 0; j != replicates.size(); ++j) {
+        double variance = UnivariateDistribution<double>::GetSampleMeanAndVariance(replicates[j]).second;
+        errors[j] = std::sqrt(variance * correction);
+    }
+    return errors;
+}
+
+template < typename T >
+std::vector<DoublePair> Bootstrap<T>::PercentileIntervals(double significanceLevel) const
+{
+    checkRun(significanceLevel);
+    double halfAlpha = 0.5 * significanceLevel;
+    std::vector<DoublePair> intervals(replicates.size());
+    for (size_t j = 0; j != replicates.size(); ++j) {
+        std::vector<double> bounds = UnivariateDistribution<double>::GetSampleQuantiles(replicates[j], {halfAlpha, 1.0 - halfAlpha});
+        intervals[j] = DoublePair(bounds[0], bounds[1]);
+    }
+    return intervals;
+}
+
+template < typename T >
+std::vector<DoublePair> Bootstrap<T>::BCaIntervals(double significanceLevel) const
+{
+    checkRun(significanceLevel);
+    NormalRand NormalRV(0, 1);
+    double zAlpha = NormalRV.Quantile(0.5 * significanceLevel);
+    double minProportion = 0.5 / replicatesNumber;
+    std::vector<DoublePair> intervals(replicates.size());
+    for (size_t j = 0; j != replicates.size(); ++j) {
+        /// Bias correction z0 = Φ^(-1)(P(θ* < θ)), ties are counted by halves
+        double below = 0;
+        for (const double & value : replicates[j])
+            below += (value < estimate[j]) ? 1.0 : ((value == estimate[j]) ? 0.5 : 0.0);
+        double proportion = std::clamp(below / replicatesNumber, minProportion, 1.0 - minProportion);
+        double z0 = NormalRV.Quantile(proportion);
+        double a = acceleration[j];
+        auto adjustedLevel = [&NormalRV, z0, a] (double z)
+        {
+            double zSum = z0 + z;
+            return NormalRV.F(z0 + zSum / (1.0 - a * zSum));
+        };
+        std::vector<double> bounds = UnivariateDistribution<double>::GetSampleQuantiles(replicates[j], {adjustedLevel(zAlpha), adjustedLevel(-zAlpha)});
+        intervals[j] = DoublePair(bounds[0], bounds[1]);
+    }
+    return intervals;
+}
+
+template < typename T >
+unsigned long Bootstrap<T>::substreamSeed(size_t index) const
+{
+    unsigned long long z = seed + (index + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+template < typename T >
+void Bootstrap<T>::checkRun(double significanceLevel) const
+{
+    if (replicates.empty())
+        throw std::runtime_error("Bootstrap: Run should be called before estimation of intervals");
+    if (significanceLevel <= 0 || significanceLevel >= 1)
+        throw std::invalid_argument("Bootstrap: significance level should be in the interval (0, 1)");
+}
+
+template < typename T >
+void Bootstrap<T>::runTasks(size_t tasks, size_t size, const std::function<void (size_t, std::vector<double> &)> &task)
+{
+    size_t threads = RandMath::numberOfThreads(tasks);
+    std::vector<std::vector<double>> buffers(threads, std::vector<double>(size));
+    RandMath::parallelFor(tasks, threads, [&task, &buffers] (size_t thread, size_t index)
+    {
+        task(index, buffers[thread]);
+    });
+}
+
+template < typename T >
+std::vector<double> Bootstrap<T>::jackknifeAcceleration(const std::vector<T> &sample) const
+{
+    /// Group g consists of elements with indices i = g (mod G) and is deleted by zero weights
+    size_t n = sample.size();
+    size_t groups = std::min(n, JACKKNIFE_GROUPS);
+    size_t dimension = estimate.size();
+    std::vector<std::vector<double>> values(groups);
+    runTasks(groups, n, [this, &sample, &values, n, groups] (size_t group, std::vector<double> &weights)
+    {
+        std::fill(weights.begin(), weights.end(), 1.0);
+        for (size_t i = group; i < n; i += groups)
+            weights[i] = 0.0;
+        values[group] = estimator(sample, weights);
+    });
+
+    /// a = Σ (θ_mean - θ_g)^3 / (6 (Σ (θ_mean - θ_g)^2)^(3/2))
+    std::vector<double> accelerations(dimension, 0.0);
+    for (size_t j = 0; j != dimension; ++j) {
+        double mean = 0;
+        for (const std::vector<double> &parameters : values)
+            mean += parameters.at(j);
+        mean /= groups;
+        double sumSq = 0, sumCube = 0;
+        for (const std::vector<double> &parameters : values) {
+            double deviation = mean - parameters[j];
+            double deviationSq = deviation * deviation;
+            sumSq += deviationSq;
+            sumCube += deviationSq * deviation;
+        }
+        if (sumSq > 0)
+            accelerations[j] = sumCube / (6.0 * sumSq * std::sqrt(sumSq));
+    }
+    return accelerations;
+}
+
+template class Bootstrap<double>;
+template class Bootstrap<int>;
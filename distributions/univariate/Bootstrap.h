@@ -0,0 +1,162 @@
+#ifndef BOOTSTRAP_H
+#define BOOTSTRAP_H
+
+#include "UnivariateDistribution.h"
+
+/**
+ * @brief The Bootstrap class <BR>
+ * Nonparametric bootstrap of estimators of distribution parameters
+ *
+ * Each replicate draws n indices of the sample with replacement by Lemire's method
+ * and passes their multiplicities as weights to the weighted estimator,
+ * so that resampled copies of the sample are never materialized.
+ * Replicates are distributed among threads, each thread reuses one buffer of weights.
+ * Replicate b is generated by its own substream, seeded by a hash of (seed, b),
+ * so that the result depends only on the seed and not on the number of threads.
+ *
+ * Percentile and bias-corrected and accelerated (BCa) intervals are given for each parameter,
+ * acceleration is estimated by the grouped jackknife, which deletes groups by zero weights.
+ */
+template < typename T >
+class RANDLIBSHARED_EXPORT Bootstrap
+{
+public:
+    /// estimate vector of parameters by the sample with given non-negative frequencies of elements,
+    /// the estimator is called concurrently from several threads
+    typedef std::function<std::vector<double> (const std::vector<T> &, const std::vector<double> &)> Estimator;
+
+private:
+    Estimator estimator;
+    size_t replicatesNumber = 1000; ///< number of bootstrap replicates B
+    unsigned long seed = 0; ///< seed of substreams
+    std::vector<double> estimate{}; ///< estimators for the original sample
+    std::vector<std::vector<double>> replicates{}; ///< estimators for replicates, grouped by parameters
+    std::vector<double> acceleration{}; ///< acceleration of BCa intervals for each parameter
+
+    /// maximal number of groups in the jackknife
+    static constexpr size_t JACKKNIFE_GROUPS = 100;
+
+public:
+    /**
+     * @fn Bootstrap
+     * @param parametersEstimator weighted estimator of parameters
+     * @param replicatesCount number of bootstrap replicates
+     * @param randomSeed seed of random substreams of replicates
+     */
+    explicit Bootstrap(const Estimator &parametersEstimator, size_t replicatesCount = 1000, unsigned long randomSeed = 0);
+
+    /**
+     * @fn CreateEstimator
+     * @param distribution prototype with parameters, which are used by the fit method as initial ones
+     * @param fit weighted fit method, e.g. &GammaRand::Fit
+     * @param parameters function, returning vector of parameters of the fitted distribution
+     * @return estimator, which fits a copy of the prototype in each call
+     */
+    template < class Distribution, typename ParametersGetter >
+    static Estimator CreateEstimator(const Distribution &distribution,
+                                     void (Distribution::*fit)(const std::vector<T> &, const std::vector<double> &),
+                                     const ParametersGetter &parameters)
+    {
+        return [distribution, fit, parameters] (const std::vector<T> &sample, const std::vector<double> &weights)
+        {
+            Distribution fitted(distribution);
+            (fitted.*fit)(sample, weights);
+            return std::vector<double>(parameters(fitted));
+        };
+    }
+
+    /**
+     * @fn CreateEstimator
+     * @param distribution prototype with parameters, which are used by the fit method as initial ones
+     * @param fit weighted fit method with flag of unbiased estimator, e.g. &NormalRand::Fit
+     * @param parameters function, returning vector of parameters of the fitted distribution
+     * @param unbiased flag, passed to the fit method
+     * @return estimator, which fits a copy of the prototype in each call
+     */
+    template < class Distribution, typename ParametersGetter >
+    static Estimator CreateEstimator(const Distribution &distribution,
+                                     void (Distribution::*fit)(const std::vector<T> &, const std::vector<double> &, bool),
+                                     const ParametersGetter &parameters, bool unbiased = false)
+    {
+        return [distribution, fit, parameters, unbiased] (const std::vector<T> &sample, const std::vector<double> &weights)
+        {
+            Distribution fitted(distribution);
+            (fitted.*fit)(sample, weights, unbiased);
+            return std::vector<double>(parameters(fitted));
+        };
+    }
+
+    /**
+     * @fn Run
+     * estimate parameters for the sample, its bootstrap replicates and jackknife groups
+     * @param sample
+     */
+    void Run(const std::vector<T> &sample);
+
+    /**
+     * @fn GetEstimate
+     * @return estimators for the original sample
+     */
+    inline const std::vector<double> &GetEstimate() const { return estimate; }
+
+    /**
+     * @fn GetReplicates
+     * @param index of parameter
+     * @return estimators of the parameter for all replicates
+     */
+    const std::vector<double> &GetReplicates(size_t index) const;
+
+    /**
+     * @fn StandardErrors
+     * @return standard deviations of replicates for each parameter
+     */
+    std::vector<double> StandardErrors() const;
+
+    /**
+     * @fn PercentileIntervals
+     * @param significanceLevel α
+     * @return (α/2, 1 - α/2)-quantiles of replicates for each parameter
+     */
+    std::vector<DoublePair> PercentileIntervals(double significanceLevel) const;
+
+    /**
+     * @fn BCaIntervals
+     * @param significanceLevel α
+     * @return bias-corrected and accelerated intervals of level 1 - α for each parameter
+     */
+    std::vector<DoublePair> BCaIntervals(double significanceLevel) const;
+
+private:
+    /**
+     * @fn substreamSeed
+     * @param index of replicate
+     * @return seed of the substream, mixed by the finalizer of SplitMix64
+     */
+    unsigned long substreamSeed(size_t index) const;
+
+    /**
+     * @fn checkRun
+     * throw exception if Run wasn't called or level is out of (0, 1)
+     * @param significanceLevel
+     */
+    void checkRun(double significanceLevel) const;
+
+    /**
+     * @fn runTasks
+     * run tasks by several threads, each of which has its own buffer of weights,
+     * the first exception, thrown by any task, is rethrown after all threads are finished
+     * @param tasks number of tasks
+     * @param size size of buffer of weights
+     * @param task function of index of task and buffer
+     */
+    static void runTasks(size_t tasks, size_t size, const std::function<void (size_t, std::vector<double> &)> &task);
+
+    /**
+     * @fn jackknifeAcceleration
+     * @param sample
+     * @return acceleration for each parameter by the grouped jackknife
+     */
+    std::vector<double> jackknifeAcceleration(const std::vector<T> &sample) const;
+};
+
+#endif // BOOTSTRAP_H
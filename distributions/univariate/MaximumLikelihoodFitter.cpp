@@ -0,0 +1,83 @@
+#include "MaximumLikelihoodFitter.h"
+
+template < typename T >
+MaximumLikelihoodFitter<T>::MaximumLikelihoodFitter(UnivariateDistribution<T> &fittedDistribution, const ParametersSetter &setter,
+                                                    const std::vector<double> &lower, const std::vector<double> &upper,
+                                                    const ScoreFunction &scoreFunction) :
+    distribution(fittedDistribution),
+    setParameters(setter),
+    score(scoreFunction),
+    lowerBounds(lower),
+    upperBounds(upper)
+{
+    if (lowerBounds.empty() || lowerBounds.size() != upperBounds.size())
+        throw std::invalid_argument("Maximum-likelihood fitter: boundaries should be given for each parameter");
+    for (size_t i = 0; i != lowerBounds.size(); ++i) {
+        if (!(lowerBounds[i] <= upperBounds[i]))
+            throw std::invalid_argument("Maximum-likelihood fitter: lower boundary should not be bigger than upper one");
+    }
+}
+
+template < typename T >
+bool MaximumLikelihoodFitter<T>::Fit(const std::vector<T> &sample, std::vector<double> &parameters) const
+{
+    return fit(sample, {}, parameters);
+}
+
+template < typename T >
+bool MaximumLikelihoodFitter<T>::Fit(const std::vector<T> &sample, const std::vector<double> &weights, std::vector<double> &parameters) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Maximum-likelihood fitter: number of weights should be equal to the sample size");
+    return fit(sample, weights, parameters);
+}
+
+template < typename T >
+bool MaximumLikelihoodFitter<T>::fit(const std::vector<T> &sample, const std::vector<double> &weights, std::vector<double> &parameters) const
+{
+    if (parameters.size() != lowerBounds.size())
+        throw std::invalid_argument("Maximum-likelihood fitter: initial guess should be given for each parameter");
+    bool isWeighted = !weights.empty();
+    double size = isWeighted ? std::accumulate(weights.begin(), weights.end(), 0.0) : sample.size();
+    if (!(size > 0))
+        throw std::invalid_argument("Maximum-likelihood fitter: sample should be non-empty");
+
+    /// mean log-likelihood keeps tolerances of optimizers independent of the sample size
+    auto logLikelihood = [this, &sample, &weights, isWeighted, size] (const std::vector<double> &theta) -> double {
+        try {
+            setParameters(theta);
+        }
+        catch (const std::exception &) {
+            return -INFINITY;
+        }
+        double logL = isWeighted ? distribution.LogLikelihoodFunction(sample, weights) : distribution.LogLikelihoodFunction(sample);
+        return logL / size;
+    };
+
+    bool converged = false;
+    if (score) {
+        auto objective = [this, &logLikelihood, &sample, &weights, size] (const std::vector<double> &theta) {
+            double logL = logLikelihood(theta);
+            std::vector<double> gradient(theta.size(), NAN);
+            if (!std::isfinite(logL))
+                return std::make_pair(-logL, gradient);
+            gradient = score(sample, weights);
+            for (double &var : gradient)
+                var /= -size;
+            return std::make_pair(-logL, gradient);
+        };
+        converged = RandMath::findMinLBFGSB(objective, parameters, lowerBounds, upperBounds);
+    }
+    if (!converged) {
+        /// derivative-free method also refines the result of L-BFGS-B if it stopped prematurely
+        auto objective = [&logLikelihood] (const std::vector<double> &theta) {
+            return -logLikelihood(theta);
+        };
+        converged = RandMath::findMinNelderMead(objective, parameters, lowerBounds, upperBounds);
+    }
+    setParameters(parameters);
+    return converged;
+}
+
+template class MaximumLikelihoodFitter<double>;
+template class MaximumLikelihoodFitter<int>;
@@ -0,0 +1,74 @@
+#ifndef MAXIMUMLIKELIHOODFITTER_H
+#define MAXIMUMLIKELIHOODFITTER_H
+
+#include "UnivariateDistribution.h"
+
+/**
+ * @brief The MaximumLikelihoodFitter class <BR>
+ * Numerical maximum-likelihood estimation of the vector of parameters
+ * for distributions, which don't have closed-form estimators
+ *
+ * Parameters are passed to the distribution by setter, mean log-likelihood is maximized
+ * in the box [lowerBounds, upperBounds] by L-BFGS-B method if the score (gradient of log-likelihood)
+ * is given and by Nelder-Mead method otherwise or if L-BFGS-B fails.
+ * Parameters, for which setter throws an exception, are treated as the ones with zero likelihood.
+ */
+template < typename T >
+class RANDLIBSHARED_EXPORT MaximumLikelihoodFitter
+{
+public:
+    /// assign parameters to the distribution
+    typedef std::function<void (const std::vector<double> &)> ParametersSetter;
+    /// gradient of log-likelihood of the sample (with weights, if they are non-empty) w.r.t. parameters,
+    /// calculated for the current parameters of the distribution
+    typedef std::function<std::vector<double> (const std::vector<T> &, const std::vector<double> &)> ScoreFunction;
+
+private:
+    UnivariateDistribution<T> &distribution;
+    ParametersSetter setParameters;
+    ScoreFunction score;
+    std::vector<double> lowerBounds;
+    std::vector<double> upperBounds;
+
+public:
+    /**
+     * @fn MaximumLikelihoodFitter
+     * @param fittedDistribution distribution, which parameters are estimated
+     * @param setter function, assigning vector of parameters to the distribution
+     * @param lower lower boundaries of parameters
+     * @param upper upper boundaries of parameters
+     * @param scoreFunction gradient of log-likelihood (optional)
+     */
+    MaximumLikelihoodFitter(UnivariateDistribution<T> &fittedDistribution, const ParametersSetter &setter,
+                            const std::vector<double> &lower, const std::vector<double> &upper,
+                            const ScoreFunction &scoreFunction = nullptr);
+
+    /**
+     * @fn Fit
+     * @param sample
+     * @param parameters initial guess in input and estimator in output
+     * @return true if optimization converged, distribution gets estimated parameters in any case
+     */
+    bool Fit(const std::vector<T> &sample, std::vector<double> &parameters) const;
+
+    /**
+     * @fn Fit
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @param parameters initial guess in input and estimator in output
+     * @return true if optimization converged, distribution gets estimated parameters in any case
+     */
+    bool Fit(const std::vector<T> &sample, const std::vector<double> &weights, std::vector<double> &parameters) const;
+
+private:
+    /**
+     * @fn fit
+     * @param sample
+     * @param weights empty for unweighted sample
+     * @param parameters
+     * @return true if optimization converged
+     */
+    bool fit(const std::vector<T> &sample, const std::vector<double> &weights, std::vector<double> &parameters) const;
+};
+
+#endif // MAXIMUMLIKELIHOODFITTER_H
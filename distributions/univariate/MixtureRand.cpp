@@ -0,0 +1,458 @@
+#include "MixtureRand.h"
+#include "continuous/UniformRand.h"
+#include "discrete/UniformDiscreteRand.h"
+#include "math/ParallelMath.h"
+
+template < typename T >
+MixtureDistribution<T>::MixtureDistribution(const std::vector<ComponentDistribution *> &distributions, const std::vector<double> &mixtureWeights)
+{
+    if (distributions.empty())
+        throw std::invalid_argument("Mixture distribution: there should be at least one component");
+    for (const ComponentDistribution *component : distributions) {
+        if (component == nullptr)
+            throw std::invalid_argument("Mixture distribution: distribution of component should be defined");
+    }
+    components = distributions;
+    SetWeights(mixtureWeights);
+}
+
+template < typename T >
+String MixtureDistribution<T>::Name() const
+{
+    String name = "Mixture(";
+    for (size_t i = 0; i != components.size(); ++i) {
+        if (i > 0)
+            name += ", ";
+        name += this->toStringWithPrecision(weights[i]) + " * " + components[i]->Name();
+    }
+    return name + ")";
+}
+
+template < typename T >
+SUPPORT_TYPE MixtureDistribution<T>::SupportType() const
+{
+    bool isLeftBounded = true, isRightBounded = true;
+    for (const ComponentDistribution *component : components) {
+        isLeftBounded = isLeftBounded && component->isLeftBounded();
+        isRightBounded = isRightBounded && component->isRightBounded();
+    }
+    if (isLeftBounded)
+        return isRightBounded ? FINITE_T : RIGHTSEMIFINITE_T;
+    return isRightBounded ? LEFTSEMIFINITE_T : INFINITE_T;
+}
+
+template < typename T >
+T MixtureDistribution<T>::MinValue() const
+{
+    T minValue = components[0]->MinValue();
+    for (const ComponentDistribution *component : components)
+        minValue = std::min(minValue, component->MinValue());
+    return minValue;
+}
+
+template < typename T >
+T MixtureDistribution<T>::MaxValue() const
+{
+    T maxValue = components[0]->MaxValue();
+    for (const ComponentDistribution *component : components)
+        maxValue = std::max(maxValue, component->MaxValue());
+    return maxValue;
+}
+
+template < typename T >
+void MixtureDistribution<T>::SetWeights(const std::vector<double> &mixtureWeights)
+{
+    if (mixtureWeights.size() != components.size())
+        throw std::invalid_argument("Mixture distribution: weight should be given for each component");
+    double sum = 0;
+    for (double weight : mixtureWeights) {
+        if (!(weight >= 0 && weight < INFINITY))
+            throw std::invalid_argument("Mixture distribution: weights should be non-negative and finite");
+        sum += weight;
+    }
+    if (sum <= 0)
+        throw std::invalid_argument("Mixture distribution: sum of weights should be positive");
+    weights.resize(components.size());
+    logWeights.resize(components.size());
+    for (size_t i = 0; i != components.size(); ++i) {
+        weights[i] = mixtureWeights[i] / sum;
+        logWeights[i] = std::log(weights[i]);
+    }
+    updateAliasTable();
+}
+
+template < typename T >
+void MixtureDistribution<T>::updateAliasTable()
+{
+    /// Columns with scaled probability below 1 are filled by the excess of columns above 1
+    size_t size = weights.size();
+    aliasProbabilities.resize(size);
+    aliases.resize(size);
+    std::vector<double> scaled(size);
+    std::vector<size_t> small, large;
+    for (size_t i = 0; i != size; ++i) {
+        scaled[i] = weights[i] * size;
+        aliases[i] = i;
+        (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+        size_t less = small.back(), more = large.back();
+        small.pop_back();
+        aliasProbabilities[less] = scaled[less];
+        aliases[less] = more;
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+        if (scaled[more] < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+    /// Remaining columns are full up to rounding errors
+    for (size_t i : large)
+        aliasProbabilities[i] = 1.0;
+    for (size_t i : small)
+        aliasProbabilities[i] = 1.0;
+}
+
+template < typename T >
+size_t MixtureDistribution<T>::chooseComponent(RandGenerator &randGenerator) const
+{
+    size_t column = UniformDiscreteRand::StandardVariate(components.size(), randGenerator);
+    return (UniformRand::StandardVariate(randGenerator) < aliasProbabilities[column]) ? column : aliases[column];
+}
+
+template < typename T >
+double MixtureDistribution<T>::componentLogDensity(const ComponentDistribution *component, const T & x)
+{
+    if constexpr (std::is_same<T, double>::value)
+        return component->logf(x);
+    else
+        return component->logP(x);
+}
+
+template < typename T >
+double MixtureDistribution<T>::mixtureDensity(const T & x) const
+{
+    double density = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        if constexpr (std::is_same<T, double>::value)
+            density += weights[i] * components[i]->f(x);
+        else
+            density += weights[i] * components[i]->P(x);
+    }
+    return density;
+}
+
+template < typename T >
+double MixtureDistribution<T>::mixtureLogDensity(const T & x) const
+{
+    /// Log-sum-exp in one pass: sum is rescaled whenever the maximal term is updated
+    double maxTerm = -INFINITY, sum = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        double term = logWeights[i] + componentLogDensity(components[i], x);
+        if (term == -INFINITY)
+            continue;
+        if (term <= maxTerm) {
+            sum += std::exp(term - maxTerm);
+        }
+        else {
+            sum = sum * std::exp(maxTerm - term) + 1.0;
+            maxTerm = term;
+        }
+    }
+    return (maxTerm == -INFINITY) ? -INFINITY : maxTerm + std::log(sum);
+}
+
+template < typename T >
+double MixtureDistribution<T>::F(const T & x) const
+{
+    double y = 0;
+    for (size_t i = 0; i != components.size(); ++i)
+        y += weights[i] * components[i]->F(x);
+    return y;
+}
+
+template < typename T >
+double MixtureDistribution<T>::S(const T & x) const
+{
+    double y = 0;
+    for (size_t i = 0; i != components.size(); ++i)
+        y += weights[i] * components[i]->S(x);
+    return y;
+}
+
+template < typename T >
+T MixtureDistribution<T>::Variate() const
+{
+    return components[chooseComponent(this->localRandGenerator)]->Variate();
+}
+
+template < typename T >
+void MixtureDistribution<T>::Sample(std::vector<T> &outputData) const
+{
+    /// Components are chosen first, then each component is sampled by one call
+    /// and its variates are scattered to the chosen positions
+    size_t size = components.size();
+    std::vector<size_t> choices(outputData.size());
+    std::vector<size_t> counts(size, 0);
+    for (size_t & choice : choices) {
+        choice = chooseComponent(this->localRandGenerator);
+        ++counts[choice];
+    }
+    std::vector<std::vector<T>> variates(size);
+    for (size_t i = 0; i != size; ++i) {
+        variates[i].resize(counts[i]);
+        if (counts[i] > 0)
+            components[i]->Sample(variates[i]);
+    }
+    std::fill(counts.begin(), counts.end(), 0);
+    for (size_t j = 0; j != outputData.size(); ++j) {
+        size_t choice = choices[j];
+        outputData[j] = variates[choice][counts[choice]++];
+    }
+}
+
+template < typename T >
+void MixtureDistribution<T>::ReseedComponents(unsigned long seed) const
+{
+    for (size_t i = 0; i != components.size(); ++i)
+        components[i]->Reseed(seed + i);
+}
+
+template < typename T >
+double MixtureDistribution<T>::Mean() const
+{
+    double mean = 0;
+    for (size_t i = 0; i != components.size(); ++i)
+        mean += weights[i] * components[i]->Mean();
+    return mean;
+}
+
+template < typename T >
+double MixtureDistribution<T>::Variance() const
+{
+    /// Law of total variance
+    double mean = Mean(), variance = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        double deviation = components[i]->Mean() - mean;
+        variance += weights[i] * (components[i]->Variance() + deviation * deviation);
+    }
+    return variance;
+}
+
+template < typename T >
+double MixtureDistribution<T>::Skewness() const
+{
+    /// Third central moment is Σ π_k (μ3_k + 3 σ_k^2 d_k + d_k^3), where d_k is deviation of the mean of component
+    double mean = Mean(), variance = Variance(), moment = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        double deviation = components[i]->Mean() - mean;
+        double componentVariance = components[i]->Variance();
+        double thirdMoment = components[i]->Skewness() * componentVariance * std::sqrt(componentVariance);
+        moment += weights[i] * (thirdMoment + deviation * (3 * componentVariance + deviation * deviation));
+    }
+    return moment / (variance * std::sqrt(variance));
+}
+
+template < typename T >
+double MixtureDistribution<T>::ExcessKurtosis() const
+{
+    /// Fourth central moment is Σ π_k (μ4_k + 4 μ3_k d_k + 6 σ_k^2 d_k^2 + d_k^4)
+    double mean = Mean(), variance = Variance(), moment = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        double deviation = components[i]->Mean() - mean, deviationSq = deviation * deviation;
+        double componentVariance = components[i]->Variance();
+        double thirdMoment = components[i]->Skewness() * componentVariance * std::sqrt(componentVariance);
+        double fourthMoment = components[i]->Kurtosis() * componentVariance * componentVariance;
+        moment += weights[i] * (fourthMoment + 4 * thirdMoment * deviation + deviationSq * (6 * componentVariance + deviationSq));
+    }
+    return moment / (variance * variance) - 3.0;
+}
+
+template < typename T >
+std::complex<double> MixtureDistribution<T>::CFImpl(double t) const
+{
+    std::complex<double> y = 0.0;
+    for (size_t i = 0; i != components.size(); ++i)
+        y += weights[i] * components[i]->CF(t);
+    return y;
+}
+
+template < typename T >
+void MixtureDistribution<T>::Fit(const std::vector<T> &sample, const std::vector<ComponentFitter> &fitters, double tolerance, int maxIter)
+{
+    fit(sample, {}, fitters, tolerance, maxIter);
+}
+
+template < typename T >
+void MixtureDistribution<T>::Fit(const std::vector<T> &sample, const std::vector<double> &sampleWeights, const std::vector<ComponentFitter> &fitters,
+                                 double tolerance, int maxIter)
+{
+    if (sampleWeights.size() != sample.size())
+        throw std::invalid_argument(this->fitErrorDescription(this->WRONG_SAMPLE, "Number of weights should be equal to the sample size"));
+    if (std::any_of(sampleWeights.begin(), sampleWeights.end(), [] (double w) { return !(w >= 0 && w < INFINITY); }))
+        throw std::invalid_argument(this->fitErrorDescription(this->WRONG_SAMPLE, "Weights should be non-negative and finite"));
+    fit(sample, sampleWeights, fitters, tolerance, maxIter);
+}
+
+template < typename T >
+double MixtureDistribution<T>::computeLogNormalizers(const std::vector<T> &sample, const std::vector<double> &sampleWeights, std::vector<double> &logNormalizers,
+                                                     std::vector<double> &blocks, std::vector<double> &chunkSums, size_t threads) const
+{
+    size_t size = components.size(), n = sample.size();
+    RandMath::parallelFor(chunkSums.size(), threads, [&] (size_t thread, size_t chunk)
+    {
+        /// Block of log(π_k f_k(x_i)) is stored component by component, followed by maxima and sums over components
+        double *logDensities = blocks.data() + thread * (size + 2) * BLOCK_SIZE;
+        double *maxima = logDensities + size * BLOCK_SIZE, *sums = maxima + BLOCK_SIZE;
+        size_t chunkEnd = std::min(n, (chunk + 1) * RandMath::CHUNK_SIZE);
+        double logLikelihood = 0;
+        for (size_t start = chunk * RandMath::CHUNK_SIZE; start < chunkEnd; start += BLOCK_SIZE) {
+            size_t length = std::min(BLOCK_SIZE, chunkEnd - start);
+            const T *x = sample.data() + start;
+            for (size_t k = 0; k != size; ++k) {
+                double *row = logDensities + k * BLOCK_SIZE;
+                const ComponentDistribution *component = components[k];
+                for (size_t i = 0; i != length; ++i)
+                    row[i] = logWeights[k] + componentLogDensity(component, x[i]);
+            }
+            std::copy(logDensities, logDensities + length, maxima);
+            for (size_t k = 1; k < size; ++k) {
+                const double *row = logDensities + k * BLOCK_SIZE;
+                for (size_t i = 0; i != length; ++i)
+                    maxima[i] = std::max(maxima[i], row[i]);
+            }
+            std::fill(sums, sums + length, 0.0);
+            for (size_t k = 0; k != size; ++k) {
+                const double *row = logDensities + k * BLOCK_SIZE;
+                for (size_t i = 0; i != length; ++i)
+                    sums[i] += std::exp(row[i] - maxima[i]);
+            }
+            double *logNormalizer = logNormalizers.data() + start;
+            for (size_t i = 0; i != length; ++i)
+                logNormalizer[i] = (maxima[i] == -INFINITY) ? -INFINITY : maxima[i] + std::log(sums[i]);
+            if (sampleWeights.empty()) {
+                for (size_t i = 0; i != length; ++i)
+                    logLikelihood += logNormalizer[i];
+            }
+            else {
+                const double *w = sampleWeights.data() + start;
+                for (size_t i = 0; i != length; ++i) {
+                    if (w[i] > 0)
+                        logLikelihood += w[i] * logNormalizer[i];
+                }
+            }
+        }
+        chunkSums[chunk] = logLikelihood;
+    });
+    double logLikelihood = 0;
+    for (double chunkSum : chunkSums)
+        logLikelihood += chunkSum;
+    return logLikelihood;
+}
+
+template < typename T >
+double MixtureDistribution<T>::computeResponsibilities(size_t index, const std::vector<T> &sample, const std::vector<double> &sampleWeights,
+                                                       const std::vector<double> &logNormalizers, std::vector<double> &responsibilities,
+                                                       std::vector<double> &chunkSums, size_t threads) const
+{
+    size_t n = sample.size();
+    const ComponentDistribution *component = components[index];
+    double logWeight = logWeights[index];
+    RandMath::parallelFor(chunkSums.size(), threads, [&] (size_t, size_t chunk)
+    {
+        size_t chunkEnd = std::min(n, (chunk + 1) * RandMath::CHUNK_SIZE);
+        double sum = 0;
+        for (size_t i = chunk * RandMath::CHUNK_SIZE; i != chunkEnd; ++i) {
+            double w = sampleWeights.empty() ? 1.0 : sampleWeights[i];
+            double responsibility = 0;
+            if (w > 0)
+                responsibility = w * std::exp(logWeight + componentLogDensity(component, sample[i]) - logNormalizers[i]);
+            responsibilities[i] = responsibility;
+            sum += responsibility;
+        }
+        chunkSums[chunk] = sum;
+    });
+    double sum = 0;
+    for (double chunkSum : chunkSums)
+        sum += chunkSum;
+    return sum;
+}
+
+template < typename T >
+void MixtureDistribution<T>::fit(const std::vector<T> &sample, const std::vector<double> &sampleWeights, const std::vector<ComponentFitter> &fitters,
+                                 double tolerance, int maxIter)
+{
+    size_t size = components.size(), n = sample.size();
+    if (n == 0)
+        throw std::invalid_argument(this->fitErrorDescription(this->TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    if (fitters.size() != size || std::any_of(fitters.begin(), fitters.end(), [] (const ComponentFitter &fitter) { return !fitter; }))
+        throw std::invalid_argument(this->fitErrorDescription(this->NOT_APPLICABLE, "Fit method should be given for each component"));
+    double totalWeight = sampleWeights.empty() ? n : std::accumulate(sampleWeights.begin(), sampleWeights.end(), 0.0);
+    if (totalWeight <= 0)
+        throw std::invalid_argument(this->fitErrorDescription(this->TOO_FEW_ELEMENTS, "Sum of weights should be positive"));
+
+    /// All buffers are allocated once
+    size_t chunks = RandMath::numberOfChunks(n);
+    size_t threads = (chunks < RandMath::MIN_CHUNKS_FOR_THREADS) ? 1 : RandMath::numberOfThreads(chunks);
+    std::vector<double> logNormalizers(n), responsibilities(n), chunkSums(chunks);
+    std::vector<double> blocks(threads * (size + 2) * BLOCK_SIZE);
+    std::vector<double> newWeights(size);
+
+    double previousLogLikelihood = -INFINITY;
+    for (int iter = 0; iter != maxIter; ++iter) {
+        double logLikelihood = computeLogNormalizers(sample, sampleWeights, logNormalizers, blocks, chunkSums, threads) / totalWeight;
+        if (logLikelihood == -INFINITY)
+            throw std::invalid_argument(this->fitErrorDescription(this->WRONG_SAMPLE, "Some elements have zero density for all components"));
+        if (!std::isfinite(logLikelihood))
+            throw std::runtime_error(this->fitErrorDescription(this->UNDEFINED_ERROR, "Log-likelihood is not finite"));
+        if (std::fabs(logLikelihood - previousLogLikelihood) <= tolerance * std::max(1.0, std::fabs(logLikelihood)))
+            return;
+        previousLogLikelihood = logLikelihood;
+
+        /// M-step: components are fitted one by one with their responsibilities as weights,
+        /// components without responsibilities are left unchanged
+        for (size_t k = 0; k != size; ++k) {
+            double mass = computeResponsibilities(k, sample, sampleWeights, logNormalizers, responsibilities, chunkSums, threads);
+            newWeights[k] = mass / totalWeight;
+            if (mass > 0)
+                fitters[k](sample, responsibilities);
+        }
+        SetWeights(newWeights);
+    }
+    throw std::runtime_error(this->fitErrorDescription(this->UNDEFINED_ERROR, "EM algorithm didn't converge"));
+}
+
+template class MixtureDistribution<double>;
+template class MixtureDistribution<int>;
+
+
+MixtureRand::MixtureRand(const std::vector<ContinuousDistribution *> &distributions, const std::vector<double> &mixtureWeights) :
+    MixtureDistribution<double>(distributions, mixtureWeights)
+{
+}
+
+double MixtureRand::f(const double & x) const
+{
+    return mixtureDensity(x);
+}
+
+double MixtureRand::logf(const double & x) const
+{
+    return mixtureLogDensity(x);
+}
+
+
+DiscreteMixtureRand::DiscreteMixtureRand(const std::vector<DiscreteDistribution *> &distributions, const std::vector<double> &mixtureWeights) :
+    MixtureDistribution<int>(distributions, mixtureWeights)
+{
+}
+
+double DiscreteMixtureRand::P(const int & k) const
+{
+    return mixtureDensity(k);
+}
+
+double DiscreteMixtureRand::logP(const int & k) const
+{
+    return mixtureLogDensity(k);
+}
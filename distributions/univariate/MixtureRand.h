@@ -0,0 +1,267 @@
+#ifndef MIXTURERAND_H
+#define MIXTURERAND_H
+
+#include "continuous/ContinuousDistribution.h"
+#include "discrete/DiscreteDistribution.h"
+
+/**
+ * @brief The MixtureDistribution class <BR>
+ * Abstract class for finite mixtures of continuous or discrete distributions
+ *
+ * f(x | π, θ) = Σ π_k f_k(x | θ_k)
+ *
+ * Notation: X ~ Σ π_k X_k
+ *
+ * Component is chosen by the alias table in O(1) for sampling.
+ * Components are stored by pointer and can be fitted by the EM algorithm,
+ * which calls weighted fit methods of components with responsibilities as weights.
+ * E-step processes the sample in blocks, where log-densities of all components are stored
+ * component by component for the vectorization of log-sum-exp, and in chunks, processed by separate threads.
+ * All buffers are allocated once per fit, the memory is O(n) and doesn't depend on the number of components.
+ */
+template < typename T >
+class RANDLIBSHARED_EXPORT MixtureDistribution : public std::conditional<std::is_same<T, double>::value, ContinuousDistribution, DiscreteDistribution>::type
+{
+public:
+    /// ContinuousDistribution for T = double and DiscreteDistribution for T = int
+    typedef typename std::conditional<std::is_same<T, double>::value, ContinuousDistribution, DiscreteDistribution>::type ComponentDistribution;
+    /// weighted fit method of the component
+    typedef std::function<void (const std::vector<T> &, const std::vector<double> &)> ComponentFitter;
+
+private:
+    std::vector<ComponentDistribution *> components{}; ///< distributions of components
+    std::vector<double> weights{}; ///< mixture weights π
+    std::vector<double> logWeights{}; ///< log(π)
+    std::vector<double> aliasProbabilities{}; ///< probabilities to keep the chosen column of the alias table
+    std::vector<size_t> aliases{}; ///< alternative components of the alias table
+
+    /// number of elements in blocks of E-step
+    static constexpr size_t BLOCK_SIZE = 256;
+
+protected:
+    /**
+     * @fn MixtureDistribution
+     * @param distributions components
+     * @param mixtureWeights non-negative weights of components, which are normalized
+     */
+    MixtureDistribution(const std::vector<ComponentDistribution *> &distributions, const std::vector<double> &mixtureWeights);
+    virtual ~MixtureDistribution() {}
+
+public:
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override;
+    T MinValue() const override;
+    T MaxValue() const override;
+
+    /**
+     * @fn SetWeights
+     * @param mixtureWeights non-negative weights of components, which are normalized
+     */
+    void SetWeights(const std::vector<double> &mixtureWeights);
+    /**
+     * @fn GetWeights
+     * @return mixture weights π
+     */
+    inline const std::vector<double> &GetWeights() const { return weights; }
+    /**
+     * @fn GetNumberOfComponents
+     * @return number of components
+     */
+    inline size_t GetNumberOfComponents() const { return components.size(); }
+
+    double F(const T & x) const override;
+    double S(const T & x) const override;
+    T Variate() const override;
+    void Sample(std::vector<T> &outputData) const override;
+
+    /**
+     * @fn ReseedComponents
+     * Reseed generators of components by seed, seed + 1, ... .
+     * Components are owned by the caller and can be shared, hence Reseed of the mixture
+     * changes only the choice of components and this method should be called explicitly
+     * @param seed
+     */
+    void ReseedComponents(unsigned long seed) const;
+
+    double Mean() const override;
+    double Variance() const override;
+    double Skewness() const override;
+    double ExcessKurtosis() const override;
+
+protected:
+    /**
+     * @fn mixtureDensity
+     * @param x
+     * @return Σ π_k f_k(x)
+     */
+    double mixtureDensity(const T & x) const;
+
+    /**
+     * @fn mixtureLogDensity
+     * @param x
+     * @return log(Σ π_k f_k(x)), calculated by log-sum-exp
+     */
+    double mixtureLogDensity(const T & x) const;
+
+    std::complex<double> CFImpl(double t) const override;
+
+public:
+    /**
+     * @fn CreateFitter
+     * @param component distribution, which is one of the components of the mixture
+     * @param fit weighted fit method, e.g. &GammaRand::Fit
+     * @return function, which fits the component
+     */
+    template < class Distribution >
+    static ComponentFitter CreateFitter(Distribution &component,
+                                        void (Distribution::*fit)(const std::vector<T> &, const std::vector<double> &))
+    {
+        return [&component, fit] (const std::vector<T> &sample, const std::vector<double> &weights)
+        {
+            (component.*fit)(sample, weights);
+        };
+    }
+
+    /**
+     * @fn CreateFitter
+     * @param component distribution, which is one of the components of the mixture
+     * @param fit weighted fit method with flag of unbiased estimator, e.g. &NormalRand::Fit
+     * @param unbiased flag, passed to the fit method
+     * @return function, which fits the component
+     */
+    template < class Distribution >
+    static ComponentFitter CreateFitter(Distribution &component,
+                                        void (Distribution::*fit)(const std::vector<T> &, const std::vector<double> &, bool),
+                                        bool unbiased = false)
+    {
+        return [&component, fit, unbiased] (const std::vector<T> &sample, const std::vector<double> &weights)
+        {
+            (component.*fit)(sample, weights, unbiased);
+        };
+    }
+
+    /**
+     * @fn Fit
+     * fit weights and components by EM algorithm, starting from the current parameters
+     * @param sample
+     * @param fitters weighted fit methods of components in the same order
+     * @param tolerance relative tolerance of mean log-likelihood
+     * @param maxIter maximal number of iterations
+     */
+    void Fit(const std::vector<T> &sample, const std::vector<ComponentFitter> &fitters, double tolerance = 1e-8, int maxIter = 1000);
+
+    /**
+     * @fn Fit
+     * fit weights and components by EM algorithm for weighted (binned) sample
+     * @param sample
+     * @param sampleWeights non-negative frequencies of elements
+     * @param fitters weighted fit methods of components in the same order
+     * @param tolerance relative tolerance of mean log-likelihood
+     * @param maxIter maximal number of iterations
+     */
+    void Fit(const std::vector<T> &sample, const std::vector<double> &sampleWeights, const std::vector<ComponentFitter> &fitters,
+             double tolerance = 1e-8, int maxIter = 1000);
+
+private:
+    /**
+     * @fn componentLogDensity
+     * @param component
+     * @param x
+     * @return logarithm of pdf or pmf of the component
+     */
+    static double componentLogDensity(const ComponentDistribution *component, const T & x);
+
+    /**
+     * @fn updateAliasTable
+     * Vose's construction of the alias table for mixture weights
+     */
+    void updateAliasTable();
+
+    /**
+     * @fn chooseComponent
+     * @param randGenerator
+     * @return index of random component, chosen with probabilities π
+     */
+    size_t chooseComponent(RandGenerator &randGenerator) const;
+
+    /**
+     * @fn computeLogNormalizers
+     * E-step: log(Σ π_k f_k(x)) for each element
+     * @param sample
+     * @param sampleWeights empty for unweighted sample
+     * @param logNormalizers output
+     * @param blocks buffer of blocks of log-densities for each thread
+     * @param chunkSums buffer of partial sums for each chunk
+     * @param threads number of threads
+     * @return (weighted) log-likelihood
+     */
+    double computeLogNormalizers(const std::vector<T> &sample, const std::vector<double> &sampleWeights, std::vector<double> &logNormalizers,
+                                 std::vector<double> &blocks, std::vector<double> &chunkSums, size_t threads) const;
+
+    /**
+     * @fn computeResponsibilities
+     * E-step: weights of elements for the given component, π_k f_k(x) / Σ π_j f_j(x)
+     * @param index of component
+     * @param sample
+     * @param sampleWeights empty for unweighted sample
+     * @param logNormalizers
+     * @param responsibilities output
+     * @param chunkSums buffer of partial sums for each chunk
+     * @param threads number of threads
+     * @return sum of responsibilities
+     */
+    double computeResponsibilities(size_t index, const std::vector<T> &sample, const std::vector<double> &sampleWeights,
+                                   const std::vector<double> &logNormalizers, std::vector<double> &responsibilities,
+                                   std::vector<double> &chunkSums, size_t threads) const;
+
+    /**
+     * @fn fit
+     * @param sample
+     * @param sampleWeights empty for unweighted sample
+     * @param fitters
+     * @param tolerance
+     * @param maxIter
+     */
+    void fit(const std::vector<T> &sample, const std::vector<double> &sampleWeights, const std::vector<ComponentFitter> &fitters,
+             double tolerance, int maxIter);
+};
+
+
+/**
+ * @brief The MixtureRand class <BR>
+ * Mixture of continuous distributions
+ */
+class RANDLIBSHARED_EXPORT MixtureRand : public MixtureDistribution<double>
+{
+public:
+    /**
+     * @fn MixtureRand
+     * @param distributions components
+     * @param mixtureWeights non-negative weights of components, which are normalized
+     */
+    MixtureRand(const std::vector<ContinuousDistribution *> &distributions, const std::vector<double> &mixtureWeights);
+
+    double f(const double & x) const override;
+    double logf(const double & x) const override;
+};
+
+
+/**
+ * @brief The DiscreteMixtureRand class <BR>
+ * Mixture of discrete distributions
+ */
+class RANDLIBSHARED_EXPORT DiscreteMixtureRand : public MixtureDistribution<int>
+{
+public:
+    /**
+     * @fn DiscreteMixtureRand
+     * @param distributions components
+     * @param mixtureWeights non-negative weights of components, which are normalized
+     */
+    DiscreteMixtureRand(const std::vector<DiscreteDistribution *> &distributions, const std::vector<double> &mixtureWeights);
+
+    double P(const int & k) const override;
+    double logP(const int & k) const override;
+};
+
+#endif // MIXTURERAND_H
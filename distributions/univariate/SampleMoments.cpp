@@ -0,0 +1,269 @@
+#include "SampleMoments.h"
+#include "math/ParallelMath.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+SampleMoments::SampleMoments(int highestOrder)
+{
+    if (highestOrder < 1 || highestOrder > 4)
+        throw std::invalid_argument("Sample moments: order should be 1, 2, 3 or 4");
+    order = highestOrder;
+}
+
+void SampleMoments::Add(double x)
+{
+    /// Terriberry's extension of Welford's method
+    double nm1 = n;
+    n += 1;
+    double delta = x - mean;
+    double delta_n = delta / n;
+    double delta_nSq = delta_n * delta_n;
+    double term1 = delta * delta_n * nm1;
+    mean += delta_n;
+    if (order >= 4)
+        m4 += term1 * delta_nSq * (n * n - 3 * n + 3) + 6 * delta_nSq * m2 - 4 * delta_n * m3;
+    if (order >= 3)
+        m3 += term1 * delta_n * (n - 2) - 3 * delta_n * m2;
+    if (order >= 2)
+        m2 += term1;
+}
+
+void SampleMoments::AddBlock(const double *data, size_t size)
+{
+    /// Independent accumulators for the vectorization
+    static constexpr size_t LANES = 4;
+    for (size_t start = 0; start < size; start += BLOCK_SIZE) {
+        const double *x = data + start;
+        size_t length = std::min(BLOCK_SIZE, size - start);
+        size_t vectorLength = length - length % LANES;
+
+        /// First pass: mean of the block
+        double s1[LANES] = {};
+        for (size_t i = 0; i != vectorLength; i += LANES) {
+            for (size_t j = 0; j != LANES; ++j)
+                s1[j] += x[i + j];
+        }
+        double sum = (s1[0] + s1[1]) + (s1[2] + s1[3]);
+        for (size_t i = vectorLength; i != length; ++i)
+            sum += x[i];
+        SampleMoments block(order);
+        block.n = length;
+        block.mean = sum / length;
+
+        /// Second pass: central moments of the block, which is still in cache
+        if (order >= 2) {
+            double d1[LANES] = {}, d2[LANES] = {}, d3[LANES] = {}, d4[LANES] = {};
+            for (size_t i = 0; i != vectorLength; i += LANES) {
+                for (size_t j = 0; j != LANES; ++j) {
+                    double d = x[i + j] - block.mean, dSq = d * d;
+                    d1[j] += d;
+                    d2[j] += dSq;
+                    d3[j] += dSq * d;
+                    d4[j] += dSq * dSq;
+                }
+            }
+            for (size_t i = vectorLength; i != length; ++i) {
+                double d = x[i] - block.mean, dSq = d * d;
+                d1[0] += d;
+                d2[0] += dSq;
+                d3[0] += dSq * d;
+                d4[0] += dSq * dSq;
+            }
+            /// Correction of the rounding error of the mean
+            double correction = ((d1[0] + d1[1]) + (d1[2] + d1[3])) / length;
+            block.mean += correction;
+            block.m2 = (d2[0] + d2[1]) + (d2[2] + d2[3]) - correction * correction * length;
+            if (order >= 3)
+                block.m3 = (d3[0] + d3[1]) + (d3[2] + d3[3]);
+            if (order >= 4)
+                block.m4 = (d4[0] + d4[1]) + (d4[2] + d4[3]);
+        }
+        Merge(block);
+    }
+}
+
+void SampleMoments::Add(double x, double weight)
+{
+    if (weight == 1.0)
+        return Add(x);
+    /// Single element of given weight is merged as a sample with zero central moments
+    SampleMoments point(order);
+    point.n = weight;
+    point.mean = x;
+    Merge(point);
+}
+
+void SampleMoments::AddBlock(const double *data, const double *weights, size_t size)
+{
+    static constexpr size_t LANES = 4;
+    for (size_t start = 0; start < size; start += BLOCK_SIZE) {
+        const double *x = data + start, *w = weights + start;
+        size_t length = std::min(BLOCK_SIZE, size - start);
+        size_t vectorLength = length - length % LANES;
+
+        /// First pass: weighted mean of the block
+        double s0[LANES] = {}, s1[LANES] = {};
+        for (size_t i = 0; i != vectorLength; i += LANES) {
+            for (size_t j = 0; j != LANES; ++j) {
+                s0[j] += w[i + j];
+                s1[j] += w[i + j] * x[i + j];
+            }
+        }
+        double weightSum = (s0[0] + s0[1]) + (s0[2] + s0[3]);
+        double sum = (s1[0] + s1[1]) + (s1[2] + s1[3]);
+        for (size_t i = vectorLength; i != length; ++i) {
+            weightSum += w[i];
+            sum += w[i] * x[i];
+        }
+        if (weightSum == 0)
+            continue;
+        SampleMoments block(order);
+        block.n = weightSum;
+        block.mean = sum / weightSum;
+
+        /// Second pass: weighted central moments of the block
+        if (order >= 2) {
+            double d1[LANES] = {}, d2[LANES] = {}, d3[LANES] = {}, d4[LANES] = {};
+            for (size_t i = 0; i != vectorLength; i += LANES) {
+                for (size_t j = 0; j != LANES; ++j) {
+                    double d = x[i + j] - block.mean, wd = w[i + j] * d, wdSq = wd * d;
+                    d1[j] += wd;
+                    d2[j] += wdSq;
+                    d3[j] += wdSq * d;
+                    d4[j] += wdSq * d * d;
+                }
+            }
+            for (size_t i = vectorLength; i != length; ++i) {
+                double d = x[i] - block.mean, wd = w[i] * d, wdSq = wd * d;
+                d1[0] += wd;
+                d2[0] += wdSq;
+                d3[0] += wdSq * d;
+                d4[0] += wdSq * d * d;
+            }
+            double correction = ((d1[0] + d1[1]) + (d1[2] + d1[3])) / weightSum;
+            block.mean += correction;
+            block.m2 = (d2[0] + d2[1]) + (d2[2] + d2[3]) - correction * correction * weightSum;
+            if (order >= 3)
+                block.m3 = (d3[0] + d3[1]) + (d3[2] + d3[3]);
+            if (order >= 4)
+                block.m4 = (d4[0] + d4[1]) + (d4[2] + d4[3]);
+        }
+        Merge(block);
+    }
+}
+
+void SampleMoments::Merge(const SampleMoments &other)
+{
+    if (other.n == 0)
+        return;
+    if (n == 0) {
+        n = other.n;
+        mean = other.mean;
+        m2 = other.m2;
+        m3 = other.m3;
+        m4 = other.m4;
+        return;
+    }
+    double na = n, nb = other.n;
+    double total = na + nb;
+    double delta = other.mean - mean;
+    double deltaSq = delta * delta;
+    double nanb_n = na * nb / total;
+    if (order >= 4) {
+        m4 += other.m4 + deltaSq * deltaSq * nanb_n * (na * na - na * nb + nb * nb) / (total * total);
+        m4 += 6 * deltaSq * (na * na * other.m2 + nb * nb * m2) / (total * total);
+        m4 += 4 * delta * (na * other.m3 - nb * m3) / total;
+    }
+    if (order >= 3) {
+        m3 += other.m3 + deltaSq * delta * nanb_n * (na - nb) / total;
+        m3 += 3 * delta * (na * other.m2 - nb * m2) / total;
+    }
+    m2 += other.m2 + deltaSq * nanb_n;
+    mean += delta * nb / total;
+    n = total;
+}
+
+double SampleMoments::GetSkewness() const
+{
+    return std::sqrt(n) * m3 / std::pow(m2, 1.5);
+}
+
+double SampleMoments::GetExcessKurtosis() const
+{
+    return n * m4 / (m2 * m2) - 3.0;
+}
+
+template <typename T>
+SampleMoments SampleMoments::computeChunk(const T *data, const double *weights, size_t size, bool logarithm) const
+{
+    SampleMoments moments(order);
+    if constexpr (std::is_same<T, double>::value) {
+        if (!logarithm) {
+            if (weights == nullptr)
+                moments.AddBlock(data, size);
+            else
+                moments.AddBlock(data, weights, size);
+            return moments;
+        }
+    }
+    double buffer[BLOCK_SIZE];
+    for (size_t start = 0; start < size; start += BLOCK_SIZE) {
+        size_t length = std::min(BLOCK_SIZE, size - start);
+        if (weights == nullptr) {
+            for (size_t i = 0; i != length; ++i)
+                buffer[i] = logarithm ? std::log(data[start + i]) : data[start + i];
+            moments.AddBlock(buffer, length);
+        }
+        else {
+            /// Elements with zero weight are not transformed, as they can be out of domain
+            const double *w = weights + start;
+            for (size_t i = 0; i != length; ++i)
+                buffer[i] = (w[i] > 0) ? (logarithm ? std::log(data[start + i]) : data[start + i]) : 0.0;
+            moments.AddBlock(buffer, w, length);
+        }
+    }
+    return moments;
+}
+
+template <typename T>
+SampleMoments SampleMoments::compute(const T *data, const double *weights, size_t size, int highestOrder, bool logarithm)
+{
+    SampleMoments moments(highestOrder);
+    size_t chunks = RandMath::numberOfChunks(size);
+    if (chunks < RandMath::MIN_CHUNKS_FOR_THREADS)
+        return moments.computeChunk(data, weights, size, logarithm);
+
+    /// Chunks are always merged in the same order, whatever the number of threads
+    std::vector<SampleMoments> chunkMoments(chunks, moments);
+    RandMath::parallelForChunks(chunks, [&] (size_t i) {
+        size_t start = i * RandMath::CHUNK_SIZE;
+        chunkMoments[i] = moments.computeChunk(data + start, weights ? weights + start : nullptr,
+                                               std::min(RandMath::CHUNK_SIZE, size - start), logarithm);
+    });
+    for (const SampleMoments &chunk : chunkMoments)
+        moments.Merge(chunk);
+    return moments;
+}
+
+template <typename T>
+SampleMoments SampleMoments::Compute(const std::vector<T> &sample, int highestOrder, bool logarithm)
+{
+    return compute(sample.data(), nullptr, sample.size(), highestOrder, logarithm);
+}
+
+template <typename T>
+SampleMoments SampleMoments::Compute(const std::vector<T> &sample, const std::vector<double> &weights, int highestOrder, bool logarithm)
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Sample moments: number of weights should be equal to the sample size");
+    if (std::any_of(weights.begin(), weights.end(), [] (double w) { return !(w >= 0 && w < INFINITY); }))
+        throw std::invalid_argument("Sample moments: weights should be non-negative and finite");
+    return compute(sample.data(), weights.data(), sample.size(), highestOrder, logarithm);
+}
+
+template SampleMoments SampleMoments::Compute(const std::vector<double> &sample, int highestOrder, bool logarithm);
+template SampleMoments SampleMoments::Compute(const std::vector<int> &sample, int highestOrder, bool logarithm);
+template SampleMoments SampleMoments::Compute(const std::vector<double> &sample, const std::vector<double> &weights, int highestOrder, bool logarithm);
+template SampleMoments SampleMoments::Compute(const std::vector<int> &sample, const std::vector<double> &weights, int highestOrder, bool logarithm);
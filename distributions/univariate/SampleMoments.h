@@ -0,0 +1,148 @@
+#ifndef SAMPLEMOMENTS_H
+#define SAMPLEMOMENTS_H
+
+#include "RandLib_global.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief The SampleMoments class <BR>
+ * Number of elements, mean and sums of central powers up to the fourth of a sample,
+ * which can be merged with the ones of another sample
+ *
+ * Blocks are processed by two passes in cache with several independent accumulators,
+ * which can be vectorized, and merged by formulas of T. Chan and P. Pébay.
+ * Large samples are split into chunks of fixed size, which are processed by separate threads
+ * and merged in order, so that the result doesn't depend on the number of threads.
+ */
+class RANDLIBSHARED_EXPORT SampleMoments
+{
+    double n = 0; ///< number of elements
+    double mean = 0; ///< mean
+    double m2 = 0; ///< sum of squared deviations from the mean
+    double m3 = 0; ///< sum of cubed deviations from the mean
+    double m4 = 0; ///< sum of fourth powers of deviations from the mean
+    int order = 4; ///< highest calculated moment
+
+    /// number of elements in blocks, processed in two passes
+    static constexpr size_t BLOCK_SIZE = 256;
+
+public:
+    /**
+     * @fn SampleMoments
+     * @param highestOrder highest calculated moment: 1, 2, 3 or 4
+     */
+    explicit SampleMoments(int highestOrder = 4);
+
+    /**
+     * @fn Add
+     * update moments by one element
+     * @param x
+     */
+    void Add(double x);
+
+    /**
+     * @fn Add
+     * update moments by one element with given weight
+     * @param x
+     * @param weight non-negative frequency of element
+     */
+    void Add(double x, double weight);
+
+    /**
+     * @fn AddBlock
+     * update moments by elements of array
+     * @param data
+     * @param size
+     */
+    void AddBlock(const double *data, size_t size);
+
+    /**
+     * @fn AddBlock
+     * update moments by weighted elements of array
+     * @param data
+     * @param weights non-negative frequencies of elements
+     * @param size
+     */
+    void AddBlock(const double *data, const double *weights, size_t size);
+
+    /**
+     * @fn Merge
+     * update moments by moments of another sample
+     * @param other
+     */
+    void Merge(const SampleMoments &other);
+
+    /**
+     * @fn Compute
+     * @param sample
+     * @param highestOrder highest calculated moment: 1, 2, 3 or 4
+     * @param logarithm if true, moments of log(x) are calculated
+     * @return moments of sample
+     */
+    template <typename T>
+    static SampleMoments Compute(const std::vector<T> &sample, int highestOrder = 4, bool logarithm = false);
+
+    /**
+     * @fn Compute
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @param highestOrder highest calculated moment: 1, 2, 3 or 4
+     * @param logarithm if true, moments of log(x) are calculated
+     * @return moments of weighted sample, where count is the sum of weights
+     */
+    template <typename T>
+    static SampleMoments Compute(const std::vector<T> &sample, const std::vector<double> &weights, int highestOrder = 4, bool logarithm = false);
+
+    /**
+     * @fn GetCount
+     * @return number of elements (sum of weights)
+     */
+    inline double GetCount() const { return n; }
+    /**
+     * @fn GetMean
+     * @return sample mean
+     */
+    inline double GetMean() const { return mean; }
+    /**
+     * @fn GetVariance
+     * @return sample second central moment
+     */
+    inline double GetVariance() const { return m2 / n; }
+    /**
+     * @fn GetSkewness
+     * @return sample skewness
+     */
+    double GetSkewness() const;
+    /**
+     * @fn GetExcessKurtosis
+     * @return sample excess kurtosis
+     */
+    double GetExcessKurtosis() const;
+
+private:
+    /**
+     * @fn compute
+     * @param data
+     * @param weights nullptr for unweighted sample
+     * @param size
+     * @param highestOrder
+     * @param logarithm
+     * @return moments of sample
+     */
+    template <typename T>
+    static SampleMoments compute(const T *data, const double *weights, size_t size, int highestOrder, bool logarithm);
+
+    /**
+     * @fn computeChunk
+     * @param data
+     * @param weights nullptr for unweighted sample
+     * @param size
+     * @param logarithm
+     * @return moments of chunk
+     */
+    template <typename T>
+    SampleMoments computeChunk(const T *data, const double *weights, size_t size, bool logarithm) const;
+};
+
+#endif // SAMPLEMOMENTS_H
@@ -0,0 +1,187 @@
+#include "SufficientStatistics.h"
+#include "math/ParallelMath.h"
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+SufficientStatistics::SufficientStatistics(int statisticsTypes, double lowerBound, double upperBound)
+{
+    if (!(statisticsTypes & MOMENTS))
+        throw std::invalid_argument("Sufficient statistics: moments should be always accumulated");
+    if ((statisticsTypes & BOUNDED_LOG_MEANS) && !(lowerBound < upperBound))
+        throw std::invalid_argument("Sufficient statistics: lower bound should be smaller than upper bound");
+    statistics = statisticsTypes;
+    a = lowerBound;
+    b = upperBound;
+    bmaInv = 1.0 / (b - a);
+}
+
+void SufficientStatistics::Add(double x)
+{
+    minValue = std::min(minValue, x);
+    maxValue = std::max(maxValue, x);
+    moments.Add(x);
+    if (statistics & LOG_MOMENTS)
+        logMoments.Add(std::log(x));
+    double y = (x - a) * bmaInv;
+    if (statistics & LOG_LOWER_MEAN)
+        logLowerMoments.Add(std::log(y));
+    if (statistics & LOG_UPPER_MEAN)
+        logUpperMoments.Add(std::log1p(-y));
+}
+
+void SufficientStatistics::Add(double x, double weight)
+{
+    if (!(weight >= 0 && weight < INFINITY))
+        throw std::invalid_argument("Sufficient statistics: weights should be non-negative and finite");
+    if (weight == 0)
+        return;
+    minValue = std::min(minValue, x);
+    maxValue = std::max(maxValue, x);
+    moments.Add(x, weight);
+    if (statistics & LOG_MOMENTS)
+        logMoments.Add(std::log(x), weight);
+    double y = (x - a) * bmaInv;
+    if (statistics & LOG_LOWER_MEAN)
+        logLowerMoments.Add(std::log(y), weight);
+    if (statistics & LOG_UPPER_MEAN)
+        logUpperMoments.Add(std::log1p(-y), weight);
+}
+
+void SufficientStatistics::AddBlock(const double *data, size_t size)
+{
+    addBlock(data, nullptr, size);
+}
+
+void SufficientStatistics::AddBlock(const double *data, const double *weights, size_t size)
+{
+    if (std::any_of(weights, weights + size, [] (double w) { return !(w >= 0 && w < INFINITY); }))
+        throw std::invalid_argument("Sufficient statistics: weights should be non-negative and finite");
+    addBlock(data, weights, size);
+}
+
+void SufficientStatistics::addBlock(const double *data, const double *weights, size_t size)
+{
+    /// Transformed elements are stored in buffers, small enough to stay in cache
+    double buffer1[BUFFER_SIZE], buffer2[BUFFER_SIZE];
+    for (size_t start = 0; start < size; start += BUFFER_SIZE) {
+        const double *x = data + start, *w = weights ? weights + start : nullptr;
+        size_t length = std::min(BUFFER_SIZE, size - start);
+        if (w == nullptr) {
+            for (size_t i = 0; i != length; ++i) {
+                minValue = std::min(minValue, x[i]);
+                maxValue = std::max(maxValue, x[i]);
+            }
+            moments.AddBlock(x, length);
+        }
+        else {
+            /// Elements with zero weight are replaced by the first element with positive one,
+            /// so that they don't affect extremes and stay inside of the domain of transformations
+            size_t first = 0;
+            while (first != length && w[first] == 0)
+                ++first;
+            if (first == length)
+                continue;
+            for (size_t i = 0; i != length; ++i) {
+                buffer1[i] = (w[i] > 0) ? x[i] : x[first];
+                minValue = std::min(minValue, buffer1[i]);
+                maxValue = std::max(maxValue, buffer1[i]);
+            }
+            std::copy(buffer1, buffer1 + length, buffer2);
+            x = buffer2;
+            moments.AddBlock(x, w, length);
+        }
+        if (statistics & LOG_MOMENTS) {
+            for (size_t i = 0; i != length; ++i)
+                buffer1[i] = std::log(x[i]);
+            addToMoments(logMoments, buffer1, w, length);
+        }
+        if (statistics & LOG_LOWER_MEAN) {
+            for (size_t i = 0; i != length; ++i)
+                buffer1[i] = std::log((x[i] - a) * bmaInv);
+            addToMoments(logLowerMoments, buffer1, w, length);
+        }
+        if (statistics & LOG_UPPER_MEAN) {
+            for (size_t i = 0; i != length; ++i)
+                buffer1[i] = std::log1p((a - x[i]) * bmaInv);
+            addToMoments(logUpperMoments, buffer1, w, length);
+        }
+    }
+}
+
+void SufficientStatistics::addToMoments(SampleMoments &sampleMoments, const double *data, const double *weights, size_t size)
+{
+    if (weights == nullptr)
+        sampleMoments.AddBlock(data, size);
+    else
+        sampleMoments.AddBlock(data, weights, size);
+}
+
+template <typename T>
+void SufficientStatistics::addChunk(const T *data, const double *weights, size_t size)
+{
+    if constexpr (std::is_same<T, double>::value) {
+        addBlock(data, weights, size);
+    }
+    else {
+        double buffer[BUFFER_SIZE];
+        for (size_t start = 0; start < size; start += BUFFER_SIZE) {
+            size_t length = std::min(BUFFER_SIZE, size - start);
+            std::copy(data + start, data + start + length, buffer);
+            addBlock(buffer, weights ? weights + start : nullptr, length);
+        }
+    }
+}
+
+template <typename T>
+void SufficientStatistics::add(const T *data, const double *weights, size_t size)
+{
+    size_t chunks = RandMath::numberOfChunks(size);
+    if (chunks < RandMath::MIN_CHUNKS_FOR_THREADS)
+        return addChunk(data, weights, size);
+
+    /// Chunks are always merged in the same order, whatever the number of threads
+    SufficientStatistics empty(statistics, a, b);
+    std::vector<SufficientStatistics> chunkStatistics(chunks, empty);
+    RandMath::parallelForChunks(chunks, [&] (size_t i) {
+        size_t start = i * RandMath::CHUNK_SIZE;
+        chunkStatistics[i].addChunk(data + start, weights ? weights + start : nullptr, std::min(RandMath::CHUNK_SIZE, size - start));
+    });
+    for (const SufficientStatistics &chunk : chunkStatistics)
+        Merge(chunk);
+}
+
+template <typename T>
+void SufficientStatistics::Add(const std::vector<T> &sample)
+{
+    add(sample.data(), nullptr, sample.size());
+}
+
+template <typename T>
+void SufficientStatistics::Add(const std::vector<T> &sample, const std::vector<double> &weights)
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Sufficient statistics: number of weights should be equal to the sample size");
+    if (std::any_of(weights.begin(), weights.end(), [] (double w) { return !(w >= 0 && w < INFINITY); }))
+        throw std::invalid_argument("Sufficient statistics: weights should be non-negative and finite");
+    add(sample.data(), weights.data(), sample.size());
+}
+
+template void SufficientStatistics::Add(const std::vector<double> &sample);
+template void SufficientStatistics::Add(const std::vector<int> &sample);
+template void SufficientStatistics::Add(const std::vector<double> &sample, const std::vector<double> &weights);
+template void SufficientStatistics::Add(const std::vector<int> &sample, const std::vector<double> &weights);
+
+void SufficientStatistics::Merge(const SufficientStatistics &other)
+{
+    if (statistics != other.statistics)
+        throw std::invalid_argument("Sufficient statistics: merged statistics should be of the same types");
+    if ((statistics & BOUNDED_LOG_MEANS) && (a != other.a || b != other.b))
+        throw std::invalid_argument("Sufficient statistics: merged statistics should have the same bounds");
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+    moments.Merge(other.moments);
+    logMoments.Merge(other.logMoments);
+    logLowerMoments.Merge(other.logLowerMoments);
+    logUpperMoments.Merge(other.logUpperMoments);
+}
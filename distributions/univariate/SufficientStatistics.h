@@ -0,0 +1,219 @@
+#ifndef SUFFICIENTSTATISTICS_H
+#define SUFFICIENTSTATISTICS_H
+
+#include "SampleMoments.h"
+#include <cmath>
+
+/**
+ * @brief The SufficientStatistics class <BR>
+ * Accumulator of statistics of a sample, which are sufficient for fitting of distributions:
+ * number of elements, minimum, maximum, mean and variance, mean and variance of logarithms
+ * and, for the bounded support [a, b], means of log((x - a) / (b - a)) and log((b - x) / (b - a))
+ *
+ * Elements are added one by one or by blocks in O(1) memory,
+ * accumulators of different parts of a sample can be merged
+ * (e.g. from different threads or nodes). Each distribution, which supports fitting by statistics,
+ * has method CreateStatistics, returning accumulator with required statistics,
+ * and method FitFromStatistics, giving the same estimators as Fit for the whole sample.
+ */
+class RANDLIBSHARED_EXPORT SufficientStatistics
+{
+public:
+    enum STATISTICS_TYPE {
+        MOMENTS = 1, ///< mean and variance
+        LOG_MOMENTS = 2, ///< mean and variance of logarithms
+        LOG_LOWER_MEAN = 4, ///< mean of logarithms of distances to the left boundary
+        LOG_UPPER_MEAN = 8, ///< mean of logarithms of distances to the right boundary
+        BOUNDED_LOG_MEANS = LOG_LOWER_MEAN | LOG_UPPER_MEAN
+    };
+
+private:
+    int statistics = MOMENTS; ///< combination of STATISTICS_TYPE flags
+    double a = 0; ///< left boundary for bounded statistics
+    double b = 1; ///< right boundary for bounded statistics
+    double bmaInv = 1; ///< 1 / (b - a)
+    double minValue = INFINITY; ///< minimal element
+    double maxValue = -INFINITY; ///< maximal element
+    SampleMoments moments{2}; ///< moments of elements
+    SampleMoments logMoments{2}; ///< moments of logarithms of elements
+    SampleMoments logLowerMoments{1}; ///< moments of log((x - a) / (b - a))
+    SampleMoments logUpperMoments{1}; ///< moments of log((b - x) / (b - a))
+
+    /// number of elements in buffers of transformed elements
+    static constexpr size_t BUFFER_SIZE = 256;
+
+public:
+    /**
+     * @fn SufficientStatistics
+     * @param statisticsTypes combination of STATISTICS_TYPE flags
+     * @param lowerBound left boundary a for bounded statistics
+     * @param upperBound right boundary b for bounded statistics
+     */
+    explicit SufficientStatistics(int statisticsTypes = MOMENTS, double lowerBound = 0, double upperBound = 1);
+
+    /**
+     * @fn Add
+     * update statistics by one element
+     * @param x
+     */
+    void Add(double x);
+
+    /**
+     * @fn Add
+     * update statistics by one element with given weight
+     * @param x
+     * @param weight non-negative frequency of element
+     */
+    void Add(double x, double weight);
+
+    /**
+     * @fn AddBlock
+     * update statistics by elements of array
+     * @param data
+     * @param size
+     */
+    void AddBlock(const double *data, size_t size);
+
+    /**
+     * @fn AddBlock
+     * update statistics by weighted elements of array
+     * @param data
+     * @param weights non-negative frequencies of elements
+     * @param size
+     */
+    void AddBlock(const double *data, const double *weights, size_t size);
+
+    /**
+     * @fn Add
+     * update statistics by elements of sample in one pass over memory,
+     * large samples are processed by several threads
+     * @param sample
+     */
+    template <typename T>
+    void Add(const std::vector<T> &sample);
+
+    /**
+     * @fn Add
+     * update statistics by weighted (binned) sample,
+     * elements with zero weight are ignored
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    template <typename T>
+    void Add(const std::vector<T> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn Merge
+     * update statistics by statistics of another part of sample
+     * @param other statistics of the same types and boundaries
+     */
+    void Merge(const SufficientStatistics &other);
+
+    /**
+     * @fn HasStatistics
+     * @param statisticsTypes combination of STATISTICS_TYPE flags
+     * @return true if all given statistics are accumulated
+     */
+    inline bool HasStatistics(int statisticsTypes) const { return (statistics & statisticsTypes) == statisticsTypes; }
+
+    /**
+     * @fn GetCount
+     * @return number of elements (sum of weights)
+     */
+    inline double GetCount() const { return moments.GetCount(); }
+    /**
+     * @fn GetMin
+     * @return minimal element
+     */
+    inline double GetMin() const { return minValue; }
+    /**
+     * @fn GetMax
+     * @return maximal element
+     */
+    inline double GetMax() const { return maxValue; }
+    /**
+     * @fn GetLowerBound
+     * @return left boundary for bounded statistics
+     */
+    inline double GetLowerBound() const { return a; }
+    /**
+     * @fn GetUpperBound
+     * @return right boundary for bounded statistics
+     */
+    inline double GetUpperBound() const { return b; }
+    /**
+     * @fn GetSum
+     * @return (weighted) sum of elements
+     */
+    inline double GetSum() const { return moments.GetCount() * moments.GetMean(); }
+    /**
+     * @fn GetMean
+     * @return sample mean
+     */
+    inline double GetMean() const { return moments.GetMean(); }
+    /**
+     * @fn GetVariance
+     * @return sample second central moment
+     */
+    inline double GetVariance() const { return moments.GetVariance(); }
+    /**
+     * @fn GetLogMean
+     * @return mean of logarithms
+     */
+    inline double GetLogMean() const { return logMoments.GetMean(); }
+    /**
+     * @fn GetLogVariance
+     * @return second central moment of logarithms
+     */
+    inline double GetLogVariance() const { return logMoments.GetVariance(); }
+    /**
+     * @fn GetLogLowerMean
+     * @return mean of log((x - a) / (b - a))
+     */
+    inline double GetLogLowerMean() const { return logLowerMoments.GetMean(); }
+    /**
+     * @fn GetLogUpperMean
+     * @return mean of log((b - x) / (b - a))
+     */
+    inline double GetLogUpperMean() const { return logUpperMoments.GetMean(); }
+
+private:
+    /**
+     * @fn addBlock
+     * @param data
+     * @param weights nullptr for unweighted elements
+     * @param size
+     */
+    void addBlock(const double *data, const double *weights, size_t size);
+
+    /**
+     * @fn addToMoments
+     * @param sampleMoments
+     * @param data
+     * @param weights nullptr for unweighted elements
+     * @param size
+     */
+    static void addToMoments(SampleMoments &sampleMoments, const double *data, const double *weights, size_t size);
+
+    /**
+     * @fn addChunk
+     * update statistics by elements of array in the current thread
+     * @param data
+     * @param weights nullptr for unweighted elements
+     * @param size
+     */
+    template <typename T>
+    void addChunk(const T *data, const double *weights, size_t size);
+
+    /**
+     * @fn add
+     * update statistics by elements of array, using several threads for large arrays
+     * @param data
+     * @param weights nullptr for unweighted elements
+     * @param size
+     */
+    template <typename T>
+    void add(const T *data, const double *weights, size_t size);
+};
+
+#endif // SUFFICIENTSTATISTICS_H
@@ -1,4 +1,5 @@
 #include "UnivariateDistribution.h"
+#include <array>
 
 template< typename T >
 UnivariateDistribution<T>::UnivariateDistribution()
@@ -54,11 +55,39 @@ double UnivariateDistribution<T>::Quantile1m(double p) const
 }
 
 template< typename T >
-void UnivariateDistribution<T>::QuantileFunction(const std::vector<double> &p, std::vector<double> &y)
+void UnivariateDistribution<T>::QuantileFunction(const std::vector<double> &p, std::vector<double> &y) const
 {
-    int size = std::min(p.size(), y.size());
-    for (int i = 0; i != size; ++i)
+    size_t size = std::min(p.size(), y.size());
+    std::vector<size_t> order;
+    order.reserve(size);
+    for (size_t i = 0; i != size; ++i) {
+        if (p[i] >= 0.0 && p[i] <= 1.0)
+            order.push_back(i);
+        else
+            y[i] = NAN;
+    }
+    /// sort indices by probabilities, unless they are already monotone
+    auto isLess = [&p] (size_t i, size_t j) { return p[i] < p[j]; };
+    auto isGreater = [&p] (size_t i, size_t j) { return p[i] > p[j]; };
+    if (std::is_sorted(order.begin(), order.end(), isGreater))
+        std::reverse(order.begin(), order.end());
+    else if (!std::is_sorted(order.begin(), order.end(), isLess))
+        std::sort(order.begin(), order.end(), isLess);
+    /// hint is only a starting point, hence the result doesn't depend on it;
+    /// it is visible only to this distribution and the previous one is restored on exit,
+    /// so that nested calls and exceptions don't leave a stale hint
+    class HintGuard {
+        QuantileHint saved;
+    public:
+        explicit HintGuard(const UnivariateDistribution *owner) : saved(quantileHint) { quantileHint = {owner, NAN}; }
+        ~HintGuard() { quantileHint = saved; }
+        HintGuard(const HintGuard &) = delete;
+        HintGuard &operator=(const HintGuard &) = delete;
+    } guard(this);
+    for (size_t i : order) {
         y[i] = Quantile(p[i]);
+        quantileHint.value = y[i];
+    }
 }
 
 template< typename T >
@@ -220,6 +249,15 @@ bool UnivariateDistribution<T>::allElementsArePositive(const std::vector<T> &sam
     return true;
 }
 
+template< typename T >
+void UnivariateDistribution<T>::checkStatistics(const SufficientStatistics &statistics, int statisticsTypes)
+{
+    if (!statistics.HasStatistics(statisticsTypes))
+        throw std::invalid_argument(this->fitErrorDescription(this->NOT_APPLICABLE, this->MISSING_STATISTICS));
+    if (statistics.GetCount() == 0)
+        throw std::invalid_argument(this->fitErrorDescription(this->TOO_FEW_ELEMENTS, "Statistics are empty"));
+}
+
 template< typename T >
 double UnivariateDistribution<T>::Kurtosis() const
 {
@@ -242,132 +280,191 @@ double UnivariateDistribution<T>::GetSampleMean(const std::vector<T> &sample)
 template< typename T >
 double UnivariateDistribution<T>::GetSampleLogMean(const std::vector<T> &sample)
 {
-    long double sum = 0.0;
-    for (const T & var : sample)
-        sum += std::log(var);
-    return sum / sample.size();
+    return SampleMoments::Compute(sample, 1, true).GetMean();
 }
 
 template< typename T >
 double UnivariateDistribution<T>::GetSampleVariance(const std::vector<T> &sample, double mean)
 {
-    long double sum = 0.0l;
-    for (const T & var : sample) {
-        double temp = var - mean;
-        sum += temp * temp;
-    }
-    return sum / sample.size();
+    /// Second moment around the given point is shifted central one
+    SampleMoments moments = SampleMoments::Compute(sample, 2);
+    double shift = moments.GetMean() - mean;
+    return moments.GetVariance() + shift * shift;
 }
 
 template< typename T >
 double UnivariateDistribution<T>::GetSampleLogVariance(const std::vector<T> &sample, double logMean)
 {
-    long double sum = 0.0l;
-    for (const T & var : sample) {
-        double temp = std::log(var) - logMean;
-        sum += temp * temp;
-    }
-    return sum / sample.size();
+    SampleMoments moments = SampleMoments::Compute(sample, 2, true);
+    double shift = moments.GetMean() - logMean;
+    return moments.GetVariance() + shift * shift;
 }
 
 template< typename T >
 DoublePair UnivariateDistribution<T>::GetSampleMeanAndVariance(const std::vector<T> &sample)
 {
-    /// Welford's stable method
-    long double m = 0.0l, v = 0.0l;
-    int n = sample.size();
-    for (int i = 0; i < n; ++i) {
-        double x = sample[i];
-        double diff = x - m;
-        m += diff / (i + 1);
-        v += diff * (x - m);
-    }
-    return std::make_pair(m, v / n);
+    SampleMoments moments = SampleMoments::Compute(sample, 2);
+    return std::make_pair(moments.GetMean(), moments.GetVariance());
 }
 
 template< typename T >
 DoublePair UnivariateDistribution<T>::GetSampleLogMeanAndVariance(const std::vector<T> &sample)
 {
-    /// Welford's stable method
-    long double m = 0.0l, v = 0.0l;
-    int n = sample.size();
-    for (int i = 0; i < n; ++i) {
-        double logX = std::log(sample[i]);
-        double diff = logX - m;
-        m += diff / (i + 1);
-        v += diff * (logX - m);
-    }
-    return std::make_pair(m, v / n);
+    SampleMoments moments = SampleMoments::Compute(sample, 2, true);
+    return std::make_pair(moments.GetMean(), moments.GetVariance());
 }
 
 template< typename T >
 std::tuple<double, double, double, double> UnivariateDistribution<T>::GetSampleStatistics(const std::vector<T> &sample)
 {
-    /// Terriberry's extension for skewness and kurtosis
-    long double M1{}, M2{}, M3{}, M4{};
-    long double m1{}, m2{}, m3{}, m4{};
-    size_t n = sample.size(), k = 0;
-    size_t t = 0;
-    static constexpr size_t BIG_NUMBER = 10000;
-    for (const T & var : sample) {
-        ++k;
-        long double delta = var - m1;
-        long double delta_k = delta / k;
-        long double delta_kSq = delta_k * delta_k;
-        long double term1 = delta * delta_k * (k - 1);
-        m1 += delta_k;
-        m4 += term1 * delta_kSq * (k * k - 3 * k + 3) + 6 * delta_kSq * m2 - 4 * delta_k * m3;
-        m3 += term1 * delta_k * (k - 2) - 3 * delta_k * m2;
-        m2 += term1;
-
-        /// This looks like a hack and unfortunately it is. The reason of it is that the algorithm
-        /// can become unstable for sufficiently large k. For now we restart the algorithm when
-        /// k reaches some big number. In the future this can be parallelized for faster implementation.
-        if (k >= BIG_NUMBER) {
-            long double Delta = m1 - M1;
-            long double DeltaSq = Delta * Delta;
-            size_t tp1 = t + 1;
-            /// M4
-            M4 += m4 + (DeltaSq * DeltaSq * t * (t * t - t + 1) * BIG_NUMBER) / (tp1 * tp1 * tp1);
-            M4 += 6 * DeltaSq * (t * t * m2 + M2) / (tp1 * tp1);
-            M4 += 4 * Delta * (t * m3 - M3) / tp1;
-            /// M3
-            M3 += m3 + (DeltaSq * Delta * t * (t - 1) * BIG_NUMBER) / (tp1 * tp1);
-            M3 += 3 * Delta * (t * m2 - M2) / tp1;
-            /// M2 and M1
-            M2 += m2 + (DeltaSq * t) / tp1;
-            M1 += Delta / tp1;
-            k = 0;
-            m1 = 0;
-            m2 = 0;
-            m3 = 0;
-            m4 = 0;
-            ++t;
-        }
+    SampleMoments moments = SampleMoments::Compute(sample, 4);
+    return std::make_tuple(moments.GetMean(), moments.GetVariance(), moments.GetSkewness(), moments.GetExcessKurtosis());
+}
+
+template< typename T >
+double UnivariateDistribution<T>::GetSampleSum(const std::vector<T> &sample, const std::vector<double> &weights)
+{
+    SampleMoments moments = SampleMoments::Compute(sample, weights, 1);
+    return moments.GetCount() * moments.GetMean();
+}
+
+template< typename T >
+double UnivariateDistribution<T>::GetSampleMean(const std::vector<T> &sample, const std::vector<double> &weights)
+{
+    return SampleMoments::Compute(sample, weights, 1).GetMean();
+}
+
+template< typename T >
+double UnivariateDistribution<T>::GetSampleLogMean(const std::vector<T> &sample, const std::vector<double> &weights)
+{
+    return SampleMoments::Compute(sample, weights, 1, true).GetMean();
+}
+
+template< typename T >
+double UnivariateDistribution<T>::GetSampleVariance(const std::vector<T> &sample, const std::vector<double> &weights, double mean)
+{
+    SampleMoments moments = SampleMoments::Compute(sample, weights, 2);
+    double shift = moments.GetMean() - mean;
+    return moments.GetVariance() + shift * shift;
+}
+
+template< typename T >
+double UnivariateDistribution<T>::GetSampleLogVariance(const std::vector<T> &sample, const std::vector<double> &weights, double logMean)
+{
+    SampleMoments moments = SampleMoments::Compute(sample, weights, 2, true);
+    double shift = moments.GetMean() - logMean;
+    return moments.GetVariance() + shift * shift;
+}
+
+template< typename T >
+DoublePair UnivariateDistribution<T>::GetSampleMeanAndVariance(const std::vector<T> &sample, const std::vector<double> &weights)
+{
+    SampleMoments moments = SampleMoments::Compute(sample, weights, 2);
+    return std::make_pair(moments.GetMean(), moments.GetVariance());
+}
+
+template< typename T >
+DoublePair UnivariateDistribution<T>::GetSampleLogMeanAndVariance(const std::vector<T> &sample, const std::vector<double> &weights)
+{
+    SampleMoments moments = SampleMoments::Compute(sample, weights, 2, true);
+    return std::make_pair(moments.GetMean(), moments.GetVariance());
+}
+
+template< typename T >
+std::tuple<double, double, double, double> UnivariateDistribution<T>::GetSampleStatistics(const std::vector<T> &sample, const std::vector<double> &weights)
+{
+    SampleMoments moments = SampleMoments::Compute(sample, weights, 4);
+    return std::make_tuple(moments.GetMean(), moments.GetVariance(), moments.GetSkewness(), moments.GetExcessKurtosis());
+}
+
+template< typename T >
+std::vector<double> UnivariateDistribution<T>::GetSampleQuantiles(const std::vector<T> &sample, const std::vector<double> &probabilities)
+{
+    size_t n = sample.size();
+    if (n == 0)
+        throw std::invalid_argument("Sample quantiles: sample should be non-empty");
+    std::vector<size_t> ranks;
+    for (double p : probabilities) {
+        if (!(p >= 0.0 && p <= 1.0))
+            throw std::invalid_argument("Sample quantiles: probabilities should be in the interval [0, 1]");
+        double position = p * (n - 1);
+        size_t k = std::floor(position);
+        ranks.push_back(k);
+        if (position > k)
+            ranks.push_back(k + 1);
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+    /// Middle rank is selected in the range, then ranks to the left and to the right of it
+    /// are selected in the corresponding parts, so that the total work is O(n log m) for m ranks
+    std::vector<double> orderStatistics(sample.begin(), sample.end());
+    auto begin = orderStatistics.begin();
+    std::vector<std::array<size_t, 4>> ranges = {{0, n, 0, ranks.size()}};
+    while (!ranges.empty()) {
+        auto [first, last, firstRank, lastRank] = ranges.back();
+        ranges.pop_back();
+        if (firstRank == lastRank)
+            continue;
+        size_t middleRank = firstRank + (lastRank - firstRank) / 2;
+        size_t k = ranks[middleRank];
+        std::nth_element(begin + first, begin + k, begin + last);
+        ranges.push_back({first, k, firstRank, middleRank});
+        ranges.push_back({k + 1, last, middleRank + 1, lastRank});
     }
 
-    /// If something left - add the residue
-    double res = static_cast<double>(k) / BIG_NUMBER;
-    if (res != 0) {
-        long double Delta = m1 - M1;
-        long double DeltaSq = Delta * Delta;
-        double tpres = t + res;
-        /// M4
-        M4 += m4 + (DeltaSq * DeltaSq * t * res * (t * t - res * t + res * res) * BIG_NUMBER) / (tpres * tpres * tpres);
-        M4 += 6 * DeltaSq * (t * t * m2 + res * res * M2) / (tpres * tpres);
-        M4 += 4 * Delta * (t * m3 - res * M3) / tpres;
-        /// M3
-        M3 += m3 + (DeltaSq * Delta * t * res * (t - res) * BIG_NUMBER) / (tpres * tpres);
-        M3 += 3 * Delta * (t * m2 - res * M2) / tpres;
-        /// M2 and M1
-        M2 += m2 + (DeltaSq * t * res) / tpres;
-        M1 += Delta * res / tpres;
+    std::vector<double> quantiles;
+    quantiles.reserve(probabilities.size());
+    for (double p : probabilities) {
+        double position = p * (n - 1);
+        size_t k = std::floor(position);
+        double quantile = orderStatistics[k];
+        if (position > k)
+            quantile += (position - k) * (orderStatistics[k + 1] - quantile);
+        quantiles.push_back(quantile);
     }
+    return quantiles;
+}
 
-    double variance = M2 / n;
-    double skewness = std::sqrt(n) * M3 / std::pow(M2, 1.5);
-    double exkurtosis = (n * M4) / (M2 * M2) - 3.0;
-    return std::make_tuple(M1, variance, skewness, exkurtosis);
+template< typename T >
+std::vector<std::complex<double>> UnivariateDistribution<T>::GetSampleCharacteristicFunction(const std::vector<T> &sample, double step, int size)
+{
+    if (sample.empty())
+        throw std::invalid_argument("Sample characteristic function: sample should be non-empty");
+    if (size < 1)
+        throw std::invalid_argument("Sample characteristic function: number of points should be positive");
+    static constexpr size_t BLOCK_SIZE = 256;
+    double cosHx[BLOCK_SIZE], sinHx[BLOCK_SIZE], re[BLOCK_SIZE], im[BLOCK_SIZE];
+    std::vector<double> sumRe(size), sumIm(size);
+    for (size_t start = 0; start < sample.size(); start += BLOCK_SIZE) {
+        size_t length = std::min(BLOCK_SIZE, sample.size() - start);
+        for (size_t i = 0; i != length; ++i) {
+            double hx = step * sample[start + i];
+            re[i] = cosHx[i] = std::cos(hx);
+            im[i] = sinHx[i] = std::sin(hx);
+        }
+        for (int k = 0; k != size; ++k) {
+            double blockRe = 0.0, blockIm = 0.0;
+            for (size_t i = 0; i != length; ++i) {
+                blockRe += re[i];
+                blockIm += im[i];
+            }
+            sumRe[k] += blockRe;
+            sumIm[k] += blockIm;
+            if (k + 1 == size)
+                break;
+            /// multiplication by exp(ihx)
+            for (size_t i = 0; i != length; ++i) {
+                double temp = re[i] * cosHx[i] - im[i] * sinHx[i];
+                im[i] = re[i] * sinHx[i] + im[i] * cosHx[i];
+                re[i] = temp;
+            }
+        }
+    }
+    std::vector<std::complex<double>> cf(size);
+    for (int k = 0; k != size; ++k)
+        cf[k] = std::complex<double>(sumRe[k], sumIm[k]) / static_cast<double>(sample.size());
+    return cf;
 }
 
 template class UnivariateDistribution<double>;
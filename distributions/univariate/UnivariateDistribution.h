@@ -2,6 +2,9 @@
 #define UNIVARIATEDISTRIBUTION_H
 
 #include "../ProbabilityDistribution.h"
+#include "SufficientStatistics.h"
+#include "math/ParallelMath.h"
+#include <array>
 
 enum SUPPORT_TYPE {
     FINITE_T,
@@ -83,6 +86,22 @@ protected:
      * @return E[g(x)]
      */
     virtual double ExpectedValue(const std::function<double (double)> &funPtr, T minPoint, T maxPoint) const = 0;
+
+    /**
+     * @fn getQuantileHint
+     * @return quantile, calculated in the previous step of QuantileFunction of this distribution,
+     * which can be used as a starting point of numerical search (NAN otherwise)
+     */
+    double getQuantileHint() const { return (quantileHint.owner == this) ? quantileHint.value : NAN; }
+
+private:
+    /// previous quantile inside of QuantileFunction and distribution, which calculates it
+    struct QuantileHint {
+        const UnivariateDistribution *owner = nullptr;
+        double value = NAN;
+    };
+    static inline thread_local QuantileHint quantileHint{};
+
 public:
     /**
      * @fn Quantile
@@ -100,10 +119,12 @@ public:
 
     /**
      * @fn QuantileFunction
+     * Probabilities are processed in ascending order,
+     * so that numerical search starts from the previous quantile
      * @param p
      * @return fills vector y with Quantile(p)
      */
-    void QuantileFunction(const std::vector<double> &p, std::vector<double> &y);
+    void QuantileFunction(const std::vector<double> &p, std::vector<double> &y) const;
 
     /**
      * @fn CF
@@ -200,6 +221,22 @@ public:
      */
     virtual double LogLikelihoodFunction(const std::vector<T> &sample) const = 0;
 
+    /**
+     * @fn LikelihoodFunction
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return likelihood function for given weighted sample
+     */
+    virtual double LikelihoodFunction(const std::vector<T> &sample, const std::vector<double> &weights) const = 0;
+
+    /**
+     * @fn LogLikelihoodFunction
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return logarithm of likelihood function for given weighted sample
+     */
+    virtual double LogLikelihoodFunction(const std::vector<T> &sample, const std::vector<double> &weights) const = 0;
+
 protected:
     /**
      * @fn allElementsAreNotBiggerThan
@@ -231,6 +268,28 @@ protected:
      */
     static bool allElementsArePositive(const std::vector<T> &sample);
 
+    /**
+     * @fn checkStatistics
+     * throw exception if statistics are empty or don't contain required types
+     * @param statistics
+     * @param statisticsTypes combination of SufficientStatistics::STATISTICS_TYPE flags
+     */
+    void checkStatistics(const SufficientStatistics &statistics, int statisticsTypes);
+
+    /**
+     * @fn sumOverSample
+     * sum weighted terms g(x) over a sample in one pass over memory,
+     * large samples are split into chunks, which are processed by separate threads
+     * and merged in order, so that the result doesn't depend on the number of threads
+     * @param sample
+     * @param weights non-negative frequencies of elements (empty for unweighted sample),
+     * elements with zero weight are skipped
+     * @param terms function, returning N terms g(x) for an element x
+     * @return Σ w g(x)
+     */
+    template <size_t N, typename Function>
+    static std::array<double, N> sumOverSample(const std::vector<T> &sample, const std::vector<double> &weights, const Function &terms);
+
 public:
     /**
      * @fn GetSampleSum
@@ -289,6 +348,140 @@ public:
      * @return sample mean, variance, skewness and excess kurtosis
      */
     static std::tuple<double, double, double, double> GetSampleStatistics(const std::vector<T> &sample);
+
+    /**
+     * @fn GetSampleQuantiles
+     * Quantiles are interpolated linearly between order statistics of ranks p(n - 1),
+     * which are all found by one recursive selection over a copy of the sample
+     * @param sample
+     * @param probabilities
+     * @return sample quantiles
+     */
+    static std::vector<double> GetSampleQuantiles(const std::vector<T> &sample, const std::vector<double> &probabilities);
+
+    /**
+     * @fn GetSampleCharacteristicFunction
+     * exp(ikhx) are obtained as powers of exp(ihx) in blocks,
+     * so that each element takes one sine and cosine
+     * @param sample
+     * @param step h
+     * @param size number of points
+     * @return empirical characteristic function at points h, 2h, ..., size * h
+     */
+    static std::vector<std::complex<double>> GetSampleCharacteristicFunction(const std::vector<T> &sample, double step, int size);
+
+    /// Statistics of weighted (binned) samples, where weights are non-negative frequencies of elements
+
+    /**
+     * @fn GetSampleSum
+     * @param sample
+     * @param weights
+     * @return weighted sum of all elements in a sample
+     */
+    static double GetSampleSum(const std::vector<T> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn GetSampleMean
+     * @param sample
+     * @param weights
+     * @return weighted arithmetic average
+     */
+    static double GetSampleMean(const std::vector<T> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn GetSampleLogMean
+     * @param sample
+     * @param weights
+     * @return weighted arithmetic log-average
+     */
+    static double GetSampleLogMean(const std::vector<T> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn GetSampleVariance
+     * @param sample
+     * @param weights
+     * @param mean known mean value
+     * @return weighted sample second central moment
+     */
+    static double GetSampleVariance(const std::vector<T> &sample, const std::vector<double> &weights, double mean);
+
+    /**
+     * @fn GetSampleLogVariance
+     * @param sample
+     * @param weights
+     * @param logMean known log-mean value
+     * @return weighted sample log-variance
+     */
+    static double GetSampleLogVariance(const std::vector<T> &sample, const std::vector<double> &weights, double logMean);
+
+    /**
+     * @fn GetSampleMeanAndVariance
+     * @param sample
+     * @param weights
+     * @return weighted sample mean and variance
+     */
+    static DoublePair GetSampleMeanAndVariance(const std::vector<T> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn GetSampleLogMeanAndVariance
+     * @param sample
+     * @param weights
+     * @return weighted sample log-mean and log-variance
+     */
+    static DoublePair GetSampleLogMeanAndVariance(const std::vector<T> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn GetSampleStatistics
+     * @param sample
+     * @param weights
+     * @return weighted sample mean, variance, skewness and excess kurtosis
+     */
+    static std::tuple<double, double, double, double> GetSampleStatistics(const std::vector<T> &sample, const std::vector<double> &weights);
 };
 
+template < typename T >
+template < size_t N, typename Function >
+std::array<double, N> UnivariateDistribution<T>::sumOverSample(const std::vector<T> &sample, const std::vector<double> &weights, const Function &terms)
+{
+    if (!weights.empty() && std::any_of(weights.begin(), weights.end(), [] (double w) { return !(w >= 0 && w < INFINITY); }))
+        throw std::invalid_argument("Sample sums: weights should be non-negative and finite");
+    const T *data = sample.data();
+    const double *w = weights.empty() ? nullptr : weights.data();
+    auto sumChunk = [data, w, &terms] (size_t start, size_t end) {
+        std::array<double, N> sum{};
+        if (w == nullptr) {
+            for (size_t i = start; i != end; ++i) {
+                std::array<double, N> g = terms(data[i]);
+                for (size_t j = 0; j != N; ++j)
+                    sum[j] += g[j];
+            }
+            return sum;
+        }
+        for (size_t i = start; i != end; ++i) {
+            if (w[i] == 0)
+                continue;
+            std::array<double, N> g = terms(data[i]);
+            for (size_t j = 0; j != N; ++j)
+                sum[j] += w[i] * g[j];
+        }
+        return sum;
+    };
+
+    size_t size = sample.size();
+    size_t chunks = RandMath::numberOfChunks(size);
+    if (chunks < RandMath::MIN_CHUNKS_FOR_THREADS)
+        return sumChunk(0, size);
+    std::vector<std::array<double, N>> chunkSums(chunks);
+    RandMath::parallelForChunks(chunks, [&sumChunk, &chunkSums, size] (size_t i) {
+        size_t start = i * RandMath::CHUNK_SIZE;
+        chunkSums[i] = sumChunk(start, std::min(start + RandMath::CHUNK_SIZE, size));
+    });
+    std::array<double, N> sum{};
+    for (const std::array<double, N> &chunkSum : chunkSums) {
+        for (size_t j = 0; j != N; ++j)
+            sum[j] += chunkSum[j];
+    }
+    return sum;
+}
+
 #endif // UNIVARIATEDISTRIBUTION_H
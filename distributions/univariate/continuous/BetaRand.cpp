@@ -469,7 +469,7 @@ std::complex<double> BetaDistribution::CFImpl(double t) const
     double sinZ = std::sin(z);
     double cosZm1 = std::cos(z) - 1.0;
 
-    double re = RandMath::integral([this, z, cosZm1](double x) {
+    double re = RandMath::integralAdaptiveSimpson([this, z, cosZm1](double x) {
         if (x >= 1)
             return 0.0;
         if (x <= 0)
@@ -482,7 +482,7 @@ std::complex<double> BetaDistribution::CFImpl(double t) const
     re += betaFun;
     re += cosZm1 / beta;
 
-    double im = RandMath::integral([this, z, sinZ](double x) {
+    double im = RandMath::integralAdaptiveSimpson([this, z, sinZ](double x) {
         if (x >= 1)
             return 0.0;
         if (x <= 0)
@@ -545,7 +545,7 @@ void BetaRand::FitAlpha(double lnG, double lnG1m, double mean)
         double diff = lnG - lnG1m;
         double digammaBeta = RandMath::digamma(beta);
         /// run root-finding procedure
-        if (!RandMath::findRoot([diff, digammaBeta] (double x)
+        if (!RandMath::findRootNewtonFirstOrder([diff, digammaBeta] (double x)
         {
             double first = RandMath::digamma(x) - diff - digammaBeta;
             double second = RandMath::trigamma(x);
@@ -558,22 +558,18 @@ void BetaRand::FitAlpha(double lnG, double lnG1m, double mean)
 
 void BetaRand::FitAlpha(const std::vector<double> &sample)
 {
-    if (!allElementsAreNotSmallerThan(a, sample))
-        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, LOWER_LIMIT_VIOLATION + toStringWithPrecision(a)));
-    if (!allElementsAreNotBiggerThan(b, sample))
-        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, UPPER_LIMIT_VIOLATION + toStringWithPrecision(b)));
-
-    double lnG = GetSampleLogMean(sample);
+    int types = SufficientStatistics::LOG_LOWER_MEAN | (beta != 1.0 ? SufficientStatistics::LOG_UPPER_MEAN : 0);
+    SufficientStatistics statistics = getStatistics(sample, types);
+    double lnG = statistics.GetLogLowerMean();
     if (!std::isfinite(lnG))
         throw std::runtime_error(fitErrorDescription(WRONG_RETURN, ALPHA_ZERO));
     double lnG1m = 0.0;
     if (beta != 1.0) {
-        lnG1m = GetSampleLog1mMean(sample);
+        lnG1m = statistics.GetLogUpperMean();
         if (!std::isfinite(lnG1m))
             throw std::runtime_error(fitErrorDescription(WRONG_RETURN, BETA_ZERO));
     }
-    double mean = GetSampleMean(sample);
-    FitAlpha(lnG, lnG1m, mean);
+    FitAlpha(lnG, lnG1m, statistics.GetMean());
 }
 
 void BetaRand::FitBeta(double lnG, double lnG1m, double mean)
@@ -590,7 +586,7 @@ void BetaRand::FitBeta(double lnG, double lnG1m, double mean)
         double diff = lnG - lnG1m;
         double digammaAlpha = RandMath::digamma(alpha);
         /// run root-finding procedure
-        if (!RandMath::findRoot([diff, digammaAlpha] (double x)
+        if (!RandMath::findRootNewtonFirstOrder([diff, digammaAlpha] (double x)
         {
             double first = RandMath::digamma(x) + diff - digammaAlpha;
             double second = RandMath::trigamma(x);
@@ -603,22 +599,18 @@ void BetaRand::FitBeta(double lnG, double lnG1m, double mean)
 
 void BetaRand::FitBeta(const std::vector<double> &sample)
 {
-    if (!allElementsAreNotSmallerThan(a, sample))
-        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, LOWER_LIMIT_VIOLATION + toStringWithPrecision(a)));
-    if (!allElementsAreNotBiggerThan(b, sample))
-        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, UPPER_LIMIT_VIOLATION + toStringWithPrecision(b)));
-
-    double lnG1m = GetSampleLog1mMean(sample);
+    int types = SufficientStatistics::LOG_UPPER_MEAN | (alpha != 1.0 ? SufficientStatistics::LOG_LOWER_MEAN : 0);
+    SufficientStatistics statistics = getStatistics(sample, types);
+    double lnG1m = statistics.GetLogUpperMean();
     if (!std::isfinite(lnG1m))
         throw std::runtime_error(fitErrorDescription(WRONG_RETURN, BETA_ZERO));
     double lnG = 0.0;
     if (alpha != 1.0) {
-        lnG = GetSampleLogMean(sample);
+        lnG = statistics.GetLogLowerMean();
         if (!std::isfinite(lnG))
             throw std::runtime_error(fitErrorDescription(WRONG_RETURN, ALPHA_ZERO));
     }
-    double mean = GetSampleMean(sample);
-    FitBeta(lnG, lnG1m, mean);
+    FitBeta(lnG, lnG1m, statistics.GetMean());
 }
 
 void BetaRand::FitShapes(double lnG, double lnG1m, double mean, double variance)
@@ -635,7 +627,7 @@ void BetaRand::FitShapes(double lnG, double lnG1m, double mean, double variance)
     DoublePair shapes = std::make_pair(shape1, shape2);
 
     /// run root-finding procedure
-    if (!RandMath::findRoot([lnG, lnG1m] (DoublePair x)
+    if (!RandMath::findRootNewton2D([lnG, lnG1m] (DoublePair x)
     {
         double digammaAlphapBeta = RandMath::digamma(x.first + x.second);
         double digammaAlpha = RandMath::digamma(x.first);
@@ -660,21 +652,89 @@ void BetaRand::FitShapes(double lnG, double lnG1m, double mean, double variance)
 
 void BetaRand::FitShapes(const std::vector<double> &sample)
 {
-    if (!allElementsAreNotSmallerThan(a, sample))
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    FitFromStatistics(statistics);
+}
+
+void BetaRand::FitShapes(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    FitFromStatistics(statistics);
+}
+
+SufficientStatistics BetaRand::CreateStatistics() const
+{
+    return SufficientStatistics(SufficientStatistics::MOMENTS | SufficientStatistics::BOUNDED_LOG_MEANS, a, b);
+}
+
+void BetaRand::checkSupport(const SufficientStatistics &statistics, int statisticsTypes)
+{
+    checkStatistics(statistics, statisticsTypes);
+    if (statistics.GetLowerBound() != a || statistics.GetUpperBound() != b)
+        throw std::invalid_argument(fitErrorDescription(NOT_APPLICABLE, "Statistics should be accumulated for the same support"));
+    if (statistics.GetMin() < a)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, LOWER_LIMIT_VIOLATION + toStringWithPrecision(a)));
-    if (!allElementsAreNotBiggerThan(b, sample))
+    if (statistics.GetMax() > b)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, UPPER_LIMIT_VIOLATION + toStringWithPrecision(b)));
+}
+
+SufficientStatistics BetaRand::getStatistics(const std::vector<double> &sample, int statisticsTypes)
+{
+    /// Validation and only required statistics are calculated in one pass
+    SufficientStatistics statistics(SufficientStatistics::MOMENTS | statisticsTypes, a, b);
+    statistics.Add(sample);
+    checkSupport(statistics, statisticsTypes);
+    return statistics;
+}
 
-    double lnG = GetSampleLogMean(sample);
-    double lnG1m = GetSampleLog1mMean(sample);
+void BetaRand::FitFromStatistics(const SufficientStatistics &statistics)
+{
+    checkSupport(statistics, SufficientStatistics::BOUNDED_LOG_MEANS);
+    double lnG = statistics.GetLogLowerMean();
+    double lnG1m = statistics.GetLogUpperMean();
     if (!std::isfinite(lnG))
         throw std::runtime_error(fitErrorDescription(WRONG_RETURN, ALPHA_ZERO));
     if (!std::isfinite(lnG1m))
         throw std::runtime_error(fitErrorDescription(WRONG_RETURN, BETA_ZERO));
+    FitShapes(lnG, lnG1m, statistics.GetMean(), statistics.GetVariance());
+}
 
-    /// get initial values for shapes by method of moments
-    DoublePair stats = GetSampleMeanAndVariance(sample);
-    FitShapes(lnG, lnG1m, stats.first, stats.second);
+std::vector<double> BetaRand::LogLikelihoodGradient(const std::vector<double> &sample) const
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    return LogLikelihoodGradientFromStatistics(statistics);
+}
+
+std::vector<double> BetaRand::LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    return LogLikelihoodGradientFromStatistics(statistics);
+}
+
+std::vector<double> BetaRand::LogLikelihoodGradientFromStatistics(const SufficientStatistics &statistics) const
+{
+    if (!statistics.HasStatistics(SufficientStatistics::BOUNDED_LOG_MEANS))
+        throw std::invalid_argument("Log-likelihood gradient: statistics should contain bounded log-means");
+    if (statistics.GetLowerBound() != a || statistics.GetUpperBound() != b)
+        throw std::invalid_argument("Log-likelihood gradient: statistics should be accumulated for the same support");
+    double n = statistics.GetCount();
+    if (n == 0)
+        return {0.0, 0.0};
+    /// d/dα = ψ(α + β) - ψ(α) + log((x - a) / (b - a)), d/dβ = ψ(α + β) - ψ(β) + log((b - x) / (b - a))
+    double digammaSum = RandMath::digamma(alpha + beta);
+    double gradAlpha = digammaSum - RandMath::digamma(alpha) + statistics.GetLogLowerMean();
+    double gradBeta = digammaSum - RandMath::digamma(beta) + statistics.GetLogUpperMean();
+    return {n * gradAlpha, n * gradBeta};
+}
+
+std::vector<std::vector<double>> BetaRand::FisherInformation() const
+{
+    double trigammaSum = RandMath::trigamma(alpha + beta);
+    return {{RandMath::trigamma(alpha) - trigammaSum, -trigammaSum}, {-trigammaSum, RandMath::trigamma(beta) - trigammaSum}};
 }
 
 String ArcsineRand::Name() const
@@ -273,6 +273,72 @@ public:
      * @param sample
      */
     void FitShapes(const std::vector<double> &sample);
+
+    /**
+     * @fn FitShapes
+     * set α and β for weighted (binned) sample
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void FitShapes(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn CreateStatistics
+     * @return empty accumulator of statistics, sufficient for FitFromStatistics
+     */
+    SufficientStatistics CreateStatistics() const;
+
+    /**
+     * @fn FitFromStatistics
+     * set α and β in the same way as FitShapes for the whole sample
+     * @param statistics accumulated with the same support [a, b]
+     */
+    void FitFromStatistics(const SufficientStatistics &statistics);
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @return gradient of log-likelihood function with respect to (α, β)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample) const;
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return gradient of log-likelihood function for weighted sample with respect to (α, β)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
+
+    /**
+     * @fn LogLikelihoodGradientFromStatistics
+     * @param statistics accumulated with the same support [a, b]
+     * @return the same gradient as LogLikelihoodGradient for the whole sample
+     */
+    std::vector<double> LogLikelihoodGradientFromStatistics(const SufficientStatistics &statistics) const;
+
+    /**
+     * @fn FisherInformation
+     * @return Fisher information matrix of one observation for (α, β)
+     */
+    std::vector<std::vector<double>> FisherInformation() const;
+
+private:
+    /**
+     * @fn checkSupport
+     * throw exception if statistics are not accumulated for the support or sample is outside of it
+     * @param statistics
+     * @param statisticsTypes required types of statistics
+     */
+    void checkSupport(const SufficientStatistics &statistics, int statisticsTypes);
+
+    /**
+     * @fn getStatistics
+     * @param sample
+     * @param statisticsTypes required types of statistics
+     * @return statistics of the sample for the support [a, b]
+     */
+    SufficientStatistics getStatistics(const std::vector<double> &sample, int statisticsTypes);
 };
 
 
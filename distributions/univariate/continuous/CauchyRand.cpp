@@ -1,5 +1,6 @@
 ﻿#include "CauchyRand.h"
 #include "UniformRand.h"
+#include "ZigguratSampler.h"
 
 CauchyRand::CauchyRand(double location, double scale)
     : StableDistribution(1, 0, scale, location)
@@ -33,12 +34,15 @@ double CauchyRand::Variate() const
 
 double CauchyRand::StandardVariate(RandGenerator &randGenerator)
 {
-    double x, y;
-    do {
-        x = 2 * UniformRand::StandardVariate(randGenerator) - 1;
-        y = 2 * UniformRand::StandardVariate(randGenerator) - 1;
-    } while (y == 0.0 || x * x + y * y > 1.0);
-    return x / y;
+    /// tail beyond r is sampled as cot(θ) with θ uniform on (0, atan(1 / r)]
+    static const ZigguratSampler ziggurat([] (double x) { return 1.0 / (1.0 + x * x); },
+                                          [] (double y) { return std::sqrt(1.0 / y - 1.0); },
+                                          [] (double x) { return std::atan(1.0 / x); }, true, 256,
+                                          [] (double r, RandGenerator &generator) {
+        double theta = (1.0 - UniformRand::StandardVariate(generator)) * std::atan(1.0 / r);
+        return 1.0 / std::tan(theta);
+    });
+    return ziggurat.Variate(randGenerator);
 }
     
 std::complex<double> CauchyRand::CFImpl(double t) const
@@ -1,5 +1,6 @@
 #include "ContinuousDistribution.h"
 #include "KolmogorovSmirnovRand.h"
+#include <limits>
 
 void ContinuousDistribution::ProbabilityDensityFunction(const std::vector<double> &x, std::vector<double> &y) const
 {
@@ -19,99 +20,126 @@ void ContinuousDistribution::LogProbabilityDensityFunction(const std::vector<dou
         y[i] = logf(x[i]);
 }
 
-double ContinuousDistribution::quantileImpl(double p) const
+double ContinuousDistribution::searchQuantile(double p, bool isComplementary) const
 {
-    double guess = 0.0;
-    SUPPORT_TYPE supp = SupportType();
-    if (supp == FINITE_T && p > 1e-5) {
-        if (RandMath::findRoot([this, p] (double x)
-        {
-            return F(x) - p;
-        }, MinValue(), MaxValue(), guess))
-            return guess;
-        return NAN;
+    /// 1 - p is exact for p > 0.5, so we always solve for the smaller tail
+    if (p > 0.5) {
+        p = 1.0 - p;
+        isComplementary = !isComplementary;
     }
+    /// for small p we solve log(F(x)) = log(p) (or log(S(x)) = log(p)),
+    /// otherwise F(x) = p (or S(x) = p)
+    /// h is an increasing function with root in the quantile
+    bool useLog = (p < 1e-5);
+    double logP = std::log(p);
+    auto h = [this, p, logP, isComplementary, useLog] (double x)
+    {
+        double cdf = isComplementary ? S(x) : F(x);
+        double pdf = f(x);
+        double y = 0.0, dy = pdf;
+        if (useLog) {
+            double logCdf = std::log(cdf);
+            y = logCdf - logP;
+            dy = (cdf > 0.0) ? pdf / cdf : INFINITY;
+        }
+        else {
+            y = cdf - p;
+        }
+        return isComplementary ? DoublePair(-y, dy) : DoublePair(y, dy);
+    };
 
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<double> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    /// if p is too small
-    if (index == 0) {
-        guess = *std::min_element(sample.begin(), sample.end());
-        double logP = std::log(p);
-        if (RandMath::findRoot([this, logP] (double x)
-        {
-            double logCdf = std::log(F(x)), logPdf = logf(x);
-            double first = logCdf - logP;
-            double second = std::exp(logPdf - logCdf);
-            return DoublePair(first, second);
-        }, guess))
-            return guess;
-        return NAN;
-    }
+    /// Newton's method, safeguarded by bisection, in bracket [a, b] with one of the boundaries possibly infinite
+    static constexpr int MAX_ITER = 1100;
+    auto newton = [&h] (double a, double b, double x, double &root)
+    {
+        double dxOld = b - a, dx = dxOld;
+        for (int iter = 0; iter != MAX_ITER; ++iter) {
+            auto [y, dy] = h(x);
+            if (y == 0.0) {
+                root = x;
+                return true;
+            }
+            if (y < 0.0)
+                a = x;
+            else
+                b = x;
+            double newX = x - y / dy;
+            bool isNewtonStepGood = std::isfinite(newX) && newX > a && newX < b && std::fabs(2 * y) <= std::fabs(dxOld * dy);
+            dxOld = dx;
+            if (!isNewtonStepGood) {
+                if (!std::isfinite(a) || !std::isfinite(b))
+                    return false;
+                newX = 0.5 * (a + b);
+            }
+            dx = newX - x;
+            x = newX;
+            double tolerance = 1e-14 * std::fabs(x) + std::numeric_limits<double>::min();
+            if (std::fabs(dx) <= tolerance || b - a <= tolerance) {
+                root = x;
+                return true;
+            }
+        }
+        root = x;
+        return false;
+    };
 
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end());
-    guess = sample[index];
+    double minValue = MinValue(), maxValue = MaxValue();
+    /// warm start from the previous quantile in batch evaluation
+    double root = getQuantileHint();
+    if (root > minValue && root < maxValue && newton(minValue, maxValue, root, root))
+        return root;
 
-    if (RandMath::findRoot([this, p] (double x)
-    {
-        double first = F(x) - p;
-        double second = f(x);
-        return DoublePair(first, second);
-    }, guess))
-        return guess;
-    return NAN;
-}
+    double mean = Mean(), var = Variance();
+    double scale = (std::isfinite(var) && var > 0.0) ? std::sqrt(var) : 1.0;
+    if (std::isfinite(minValue) && std::isfinite(maxValue))
+        scale = std::min(scale, maxValue - minValue);
+    double start = 0.0;
+    if (std::isfinite(mean))
+        start = mean;
+    else if (std::isfinite(minValue))
+        start = minValue + scale;
+    else if (std::isfinite(maxValue))
+        start = maxValue - scale;
+    start = std::max(minValue, std::min(start, maxValue));
 
-double ContinuousDistribution::quantileImpl1m(double p) const
-{
-    double guess = 0.0;
-    SUPPORT_TYPE supp = SupportType();
-    /// we use this method only for sufficient large p
-    /// in order to avoid underflow
-    if (supp == FINITE_T && p > 1e-5) {
-        if (RandMath::findRoot([this, p] (double x)
-        {
-            return S(x) - p;
-        }, MinValue(), MaxValue(), guess))
-            return guess;
-        return NAN;
+    /// exponential search of the bracket [a, b], such that h(a) < 0 <= h(b)
+    double a = start, b = start, step = scale;
+    if (h(start).first < 0.0) {
+        int iter = 0;
+        do {
+            a = b;
+            b = std::min(start + step, maxValue);
+            step += step;
+        } while (b < maxValue && h(b).first < 0.0 && ++iter < MAX_ITER);
     }
-
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<double> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    /// if p is too small
-    if (index == 0) {
-        guess = *std::max_element(sample.begin(), sample.end());
-        double logP = std::log(p);
-        if (RandMath::findRoot([this, logP] (double x)
-        {
-            double logCcdf = std::log(S(x)), logPdf = logf(x);
-            double first = logP - logCcdf;
-            double second = std::exp(logPdf - logCcdf);
-            return DoublePair(first, second);
-        }, guess))
-            return guess;
-        return NAN;
+    else {
+        int iter = 0;
+        do {
+            b = a;
+            a = std::max(start - step, minValue);
+            step += step;
+        } while (a > minValue && h(a).first >= 0.0 && ++iter < MAX_ITER);
     }
+    if (!std::isfinite(a) || !std::isfinite(b))
+        return NAN;
 
-    /// Partially sort in desceding order
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end(), std::greater<>());
-    guess = sample[index];
+    /// initial guess from normal approximation if it is inside of the bracket
+    double z = M_SQRT2 * RandMath::erfinv(2 * p - 1);
+    double x = std::isfinite(mean) ? mean + (isComplementary ? -z : z) * scale : NAN;
+    if (!(x > a && x < b))
+        x = 0.5 * (a + b);
+    newton(a, b, x, root);
+    return root;
+}
 
-    if (RandMath::findRoot([this, p] (double x)
-    {
-        double first = p - S(x);
-        double second = f(x);
-        return DoublePair(first, second);
-    }, guess))
-        return guess;
-    return NAN;
+double ContinuousDistribution::quantileImpl(double p) const
+{
+    return searchQuantile(p, false);
+}
+
+double ContinuousDistribution::quantileImpl1m(double p) const
+{
+    return searchQuantile(p, true);
 }
 
 double ContinuousDistribution::Mode() const
@@ -120,7 +148,7 @@ double ContinuousDistribution::Mode() const
     if (!std::isfinite(guess))
         guess = Median(); /// this shouldn't be nan or inf
     double root = 0;
-    RandMath::findMin([this] (double x)
+    RandMath::findMinBrent([this] (double x)
     {
         return -logf(x);
     }, guess, root);
@@ -142,65 +170,39 @@ double ContinuousDistribution::ExpectedValue(const std::function<double (double)
 
     bool isLeftBoundFinite = std::isfinite(lowerBoundary), isRightBoundFinite = std::isfinite(upperBoundary);
 
-    /// Integrate on finite interval [a, b]
-    if (isLeftBoundFinite && isRightBoundFinite) {
-        return RandMath::integral([this, funPtr] (double x)
-        {
-            double y = funPtr(x);
-            return (y == 0.0) ? 0.0 : y * f(x);
-        },
-        lowerBoundary, upperBoundary);
-    }
-
-    /// Integrate on semifinite interval [a, inf)
-    if (isLeftBoundFinite) {
-        return RandMath::integral([this, funPtr, lowerBoundary] (double x)
-        {
-            if (x >= 1.0)
-                return 0.0;
-            double denom = 1.0 - x;
-            double t = lowerBoundary + x / denom;
-            double y = funPtr(t);
-            if (y == 0.0)
-                return 0.0;
-            y *= f(t);
-            denom *= denom;
-            return y / denom;
-        },
-        0.0, 1.0);
-    }
+    auto integrand = [this, &funPtr] (double x)
+    {
+        double y = funPtr(x);
+        return (y == 0.0) ? 0.0 : y * f(x);
+    };
 
-    /// Integrate on semifinite intervale (-inf, b]
-    if (isRightBoundFinite) {
-        return RandMath::integral([this, funPtr, upperBoundary] (double x)
-        {
-            if (x <= 0.0)
-                return 0.0;
-            double t = upperBoundary - (1.0 - x) / x;
-            double y = funPtr(t);
-            if (y == 0.0)
-                return 0.0;
-            y *= f(t);
-            return y / (x * x);
-        },
-        0.0, 1.0);
-    }
+    /// Integrate on finite interval [a, b]
+    if (isLeftBoundFinite && isRightBoundFinite)
+        return RandMath::integralGaussKronrod(integrand, lowerBoundary, upperBoundary);
 
-    /// Infinite case
-    return RandMath::integral([this, funPtr] (double x)
+    /// Integrate on semi-infinite or infinite interval by double exponential transformation.
+    /// Nodes are placed around the origin with unit scale, hence the interval is split
+    /// at the mean (or median) and the infinite parts are standardized by the standard deviation
+    /// (or semi-interquartile range), otherwise the mass of distributions far from the origin is missed.
+    /// Finite parts are integrated in x, so that singularities at the boundaries are kept exact
+    double center = Mean();
+    if (!std::isfinite(center))
+        center = Median();
+    center = std::min(std::max(center, lowerBoundary), upperBoundary);
+    double scale = std::sqrt(Variance());
+    if (!std::isfinite(scale) || scale <= 0.0)
+        scale = 0.5 * (Quantile(0.75) - Quantile(0.25));
+    if (!std::isfinite(scale) || scale <= 0.0)
+        scale = 1.0;
+    auto standardizedIntegrand = [&integrand, center, scale] (double u)
     {
-        if (std::fabs(x) >= 1.0)
-            return 0.0;
-        double x2 = x * x;
-        double denom = 1.0 - x2;
-        double t = x / denom;
-        double y = funPtr(t);
-        if (y == 0.0)
-            return 0.0;
-        y *= f(t);
-        denom *= denom;
-        return y * (1.0 + x2) / denom;
-    }, -1.0, 1.0);
+        return integrand(center + scale * u);
+    };
+    double lowerPart = isLeftBoundFinite ? RandMath::integralTanhSinh(integrand, lowerBoundary, center)
+                                         : scale * RandMath::integralTanhSinh(standardizedIntegrand, -INFINITY, 0.0);
+    double upperPart = isRightBoundFinite ? RandMath::integralTanhSinh(integrand, center, upperBoundary)
+                                          : scale * RandMath::integralTanhSinh(standardizedIntegrand, 0.0, INFINITY);
+    return lowerPart + upperPart;
 }
 
 double ContinuousDistribution::Hazard(double x) const
@@ -228,6 +230,23 @@ double ContinuousDistribution::LogLikelihoodFunction(const std::vector<double> &
     return res;
 }
 
+double ContinuousDistribution::LikelihoodFunction(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    return std::exp(LogLikelihoodFunction(sample, weights));
+}
+
+double ContinuousDistribution::LogLikelihoodFunction(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Log-likelihood function: number of weights should be equal to the sample size");
+    double res = 0.0;
+    for (size_t i = 0; i != sample.size(); ++i) {
+        if (weights[i] > 0)
+            res += weights[i] * logf(sample[i]);
+    }
+    return res;
+}
+
 bool ContinuousDistribution::KolmogorovSmirnovTest(const std::vector<double> &orderStatistic, double alpha) const
 {
     KolmogorovSmirnovRand KSRand;
@@ -46,6 +46,19 @@ public:
 
     double Mode() const override;
 
+private:
+    /**
+     * @fn searchQuantile
+     * Exponential search of the bracket, starting from the mean,
+     * followed by Newton's method, safeguarded by bisection.
+     * Inside of QuantileFunction Newton's method starts from the previous quantile.
+     * Log-scale is used for small p
+     * @param p
+     * @param isComplementary
+     * @return such x that F(x) = p (or S(x) = p if isComplementary is true)
+     */
+    double searchQuantile(double p, bool isComplementary) const;
+
 protected:
     double quantileImpl(double p) const override;
     double quantileImpl1m(double p) const override;
@@ -55,6 +68,8 @@ public:
     double Hazard(double x) const override;
     double LikelihoodFunction(const std::vector<double> &sample) const override;
     double LogLikelihoodFunction(const std::vector<double> &sample) const override;
+    double LikelihoodFunction(const std::vector<double> &sample, const std::vector<double> &weights) const override;
+    double LogLikelihoodFunction(const std::vector<double> &sample, const std::vector<double> &weights) const override;
 
     /**
      * @fn KolmogorovSmirnovTest
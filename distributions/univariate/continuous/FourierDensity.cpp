@@ -0,0 +1,89 @@
+#include "FourierDensity.h"
+
+FourierDensity::FourierDensity(const ContinuousDistribution &continuousDistribution, double minPoint, double maxPoint, int gridSize) :
+    distribution(continuousDistribution)
+{
+    if (!std::isfinite(minPoint) || !std::isfinite(maxPoint) || minPoint >= maxPoint)
+        throw std::invalid_argument("Fourier density: boundaries of the grid should be finite and ordered");
+    if (gridSize < 4 || (gridSize & (gridSize - 1)))
+        throw std::invalid_argument("Fourier density: size of the grid should be power of 2");
+    a = minPoint;
+    b = maxPoint;
+    h = (b - a) / (gridSize - 1);
+    pdf.resize(gridSize);
+    pdfDerivative.resize(gridSize);
+    cdf.resize(gridSize);
+    Update();
+}
+
+String FourierDensity::Name() const
+{
+    return "Fourier inversion for " + distribution.Name();
+}
+
+void FourierDensity::Update()
+{
+    /// Transform of length twice the grid size: t_n = (n + 1/2)s, s = 2π / (2Nh), x_k = a + kh
+    int n = pdf.size(), size = 2 * n;
+    double s = M_PI / (n * h);
+    std::vector<std::complex<double>> pdfSum(size), derivativeSum(size), cdfSum(size);
+    for (int j = 0; j != size; ++j) {
+        double t = (j + 0.5) * s;
+        std::complex<double> y = distribution.CF(t) * std::polar(s, -t * a);
+        pdfSum[j] = y;
+        derivativeSum[j] = std::complex<double>(0, -t) * y;
+        cdfSum[j] = y / t;
+    }
+    RandMath::fft(pdfSum);
+    RandMath::fft(derivativeSum);
+    RandMath::fft(cdfSum);
+
+    /// Shift by half of the frequency step: exp(-iπk / (2N))
+    for (int k = 0; k != n; ++k) {
+        std::complex<double> shift = std::polar(M_1_PI, -M_PI_2 * k / n);
+        pdf[k] = std::max((pdfSum[k] * shift).real(), 0.0);
+        pdfDerivative[k] = (derivativeSum[k] * shift).real();
+        cdf[k] = 0.5 - (cdfSum[k] * shift).imag();
+        cdf[k] = std::min(std::max(cdf[k], 0.0), 1.0);
+    }
+}
+
+double FourierDensity::interpolate(const std::vector<double> &y, const std::vector<double> &dy, double x) const
+{
+    double u = (x - a) / h;
+    int i = std::min(static_cast<int>(u), static_cast<int>(y.size()) - 2);
+    u -= i;
+    double u2 = u * u, u3 = u2 * u;
+    double h00 = 2 * u3 - 3 * u2 + 1, h10 = u3 - 2 * u2 + u;
+    double h01 = 3 * u2 - 2 * u3, h11 = u3 - u2;
+    return h00 * y[i] + h01 * y[i + 1] + h * (h10 * dy[i] + h11 * dy[i + 1]);
+}
+
+double FourierDensity::f(const double & x) const
+{
+    if (x < a || x > b)
+        return distribution.f(x);
+    return std::max(interpolate(pdf, pdfDerivative, x), 0.0);
+}
+
+double FourierDensity::logf(const double & x) const
+{
+    if (x < a || x > b)
+        return distribution.logf(x);
+    return std::log(f(x));
+}
+
+double FourierDensity::F(const double & x) const
+{
+    if (x < a || x > b)
+        return distribution.F(x);
+    double y = interpolate(cdf, pdf, x);
+    return std::min(std::max(y, 0.0), 1.0);
+}
+
+double FourierDensity::S(const double & x) const
+{
+    if (x < a || x > b)
+        return distribution.S(x);
+    return 1.0 - F(x);
+}
@@ -0,0 +1,98 @@
+#ifndef FOURIERDENSITY_H
+#define FOURIERDENSITY_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The FourierDensity class <BR>
+ * Wrapper for any continuous distribution with known characteristic function,
+ * which calculates pdf and cdf on equispaced grid by its inversion
+ *
+ * Method of S. Mittnik, T. Doganoglu and D. Chenyao:
+ * integrals f(x) = 1/π ∫ Re[exp(-itx) φ(t)] dt and F(x) = 1/2 - 1/π ∫ Im[exp(-itx) φ(t)] / t dt
+ * over t > 0 are approximated by midpoint rule on all points of the grid at once by FFT.
+ * The period of the transform is twice as large as the grid, so that the aliasing error
+ * is of order of the probability to be further than the length of the grid from it.
+ * Between the grid points pdf and cdf are interpolated by cubic Hermite polynomials,
+ * using derivative of pdf, obtained by the same transform, and pdf respectively.
+ * Outside of the grid the original distribution is used.
+ * Grid should be updated after parameters of original distribution are changed.
+ * Original distribution is stored by reference and should outlive the wrapper,
+ * hence temporary distributions are not accepted.
+ */
+class RANDLIBSHARED_EXPORT FourierDensity : public ContinuousDistribution
+{
+    const ContinuousDistribution &distribution; ///< original distribution
+    double a = 0; ///< left boundary of the grid
+    double b = 1; ///< right boundary of the grid
+    double h = 1; ///< step of the grid
+
+    std::vector<double> pdf{}; ///< pdf in the grid points
+    std::vector<double> pdfDerivative{}; ///< derivative of pdf in the grid points
+    std::vector<double> cdf{}; ///< cdf in the grid points
+
+public:
+    /**
+     * @fn FourierDensity
+     * @param continuousDistribution original distribution
+     * @param minPoint left boundary of the grid
+     * @param maxPoint right boundary of the grid
+     * @param gridSize number of the grid points, should be power of 2
+     */
+    FourierDensity(const ContinuousDistribution &continuousDistribution, double minPoint, double maxPoint, int gridSize = 4096);
+    FourierDensity(const ContinuousDistribution &&continuousDistribution, double minPoint, double maxPoint, int gridSize = 4096) = delete;
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override { return distribution.SupportType(); }
+    double MinValue() const override { return distribution.MinValue(); }
+    double MaxValue() const override { return distribution.MaxValue(); }
+
+    /**
+     * @fn Update
+     * recalculate the grid for current parameters of the original distribution
+     */
+    void Update();
+
+    /**
+     * @fn GetGridPoint
+     * @param i index of point
+     * @return i-th point of the grid
+     */
+    inline double GetGridPoint(int i) const { return a + i * h; }
+    /**
+     * @fn GetPdfValues
+     * @return pdf in the grid points
+     */
+    inline const std::vector<double> &GetPdfValues() const { return pdf; }
+    /**
+     * @fn GetCdfValues
+     * @return cdf in the grid points
+     */
+    inline const std::vector<double> &GetCdfValues() const { return cdf; }
+
+    double f(const double & x) const override;
+    double logf(const double & x) const override;
+    double F(const double & x) const override;
+    double S(const double & x) const override;
+    double Variate() const override { return distribution.Variate(); }
+    void Sample(std::vector<double> &outputData) const override { distribution.Sample(outputData); }
+
+    double Mean() const override { return distribution.Mean(); }
+    double Variance() const override { return distribution.Variance(); }
+    double Mode() const override { return distribution.Mode(); }
+    double Skewness() const override { return distribution.Skewness(); }
+    double ExcessKurtosis() const override { return distribution.ExcessKurtosis(); }
+
+private:
+    /**
+     * @fn interpolate
+     * @param y values in the grid points
+     * @param dy derivatives in the grid points
+     * @param x point inside of the grid
+     * @return cubic Hermite interpolation
+     */
+    double interpolate(const std::vector<double> &y, const std::vector<double> &dy, double x) const;
+
+    std::complex<double> CFImpl(double t) const override { return distribution.CF(t); }
+};
+
+#endif // FOURIERDENSITY_H
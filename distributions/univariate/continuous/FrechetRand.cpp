@@ -141,3 +141,73 @@ double FrechetRand::Entropy() const
 {
     return 1.0 + M_EULER * (1.0 + alphaInv) + std::log(s / alpha);
 }
+
+void FrechetRand::Fit(const std::vector<double> &sample)
+{
+    fit(sample, {});
+}
+
+void FrechetRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, "Number of weights should be equal to the sample size"));
+    fit(sample, weights);
+}
+
+void FrechetRand::fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (sample.empty())
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    /// Initial location is below the minimum by half of geometric mean of distances to it
+    double minVar = *std::min_element(sample.begin(), sample.end());
+    double logGapSum = 0, total = 0;
+    for (size_t i = 0; i != sample.size(); ++i) {
+        double weight = weights.empty() ? 1.0 : weights[i];
+        if (sample[i] > minVar && weight > 0) {
+            logGapSum += weight * std::log(sample[i] - minVar);
+            total += weight;
+        }
+    }
+    double location = minVar - ((total > 0) ? 0.5 * std::exp(logGapSum / total) : 1.0);
+    /// For given location, log(X - m) has Gumbel distribution with mean log(s) + γ / α and variance π^2 / (6 α^2)
+    double logMean = 0, logSecondMoment = 0;
+    total = 0;
+    for (size_t i = 0; i != sample.size(); ++i) {
+        double weight = weights.empty() ? 1.0 : weights[i];
+        double logGap = std::log(sample[i] - location);
+        logMean += weight * logGap;
+        logSecondMoment += weight * logGap * logGap;
+        total += weight;
+    }
+    logMean /= total;
+    double logVariance = logSecondMoment / total - logMean * logMean;
+    double shape = (logVariance > 0) ? M_PI / std::sqrt(6 * logVariance) : 1.0;
+    double scale = std::exp(logMean - M_EULER / shape);
+    std::vector<double> parameters = {shape, scale, location};
+
+    /// Score: d/dα = 1 / α - (1 - z^(-α)) log(z), d/ds = α (1 - z^(-α)) / s,
+    /// d/dm = (1 + α - α z^(-α)) / (x - m), where z = (x - m) / s
+    MaximumLikelihoodFitter<double> fitter(*this, [this] (const std::vector<double> &theta)
+    {
+        SetParameters(theta[0], theta[1], theta[2]);
+    },
+    {0.0, 0.0, -INFINITY}, {INFINITY, INFINITY, minVar},
+    [this] (const std::vector<double> &data, const std::vector<double> &w)
+    {
+        double gradAlpha = 0, gradScale = 0, gradLocation = 0;
+        for (size_t i = 0; i != data.size(); ++i) {
+            double weight = w.empty() ? 1.0 : w[i];
+            if (weight == 0)
+                continue;
+            double logZ = std::log((data[i] - m) / s);
+            double zPow = std::exp(-alpha * logZ);
+            gradAlpha += weight * (alphaInv - (1.0 - zPow) * logZ);
+            gradScale += weight * (1.0 - zPow);
+            gradLocation += weight * (1.0 + alpha - alpha * zPow) / (data[i] - m);
+        }
+        return std::vector<double>{gradAlpha, alpha * gradScale / s, gradLocation};
+    });
+    bool converged = weights.empty() ? fitter.Fit(sample, parameters) : fitter.Fit(sample, weights, parameters);
+    if (!converged)
+        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in optimization procedure"));
+}
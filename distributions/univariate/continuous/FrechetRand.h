@@ -2,6 +2,7 @@
 #define FRECHETRAND_H
 
 #include "ContinuousDistribution.h"
+#include "../MaximumLikelihoodFitter.h"
 
 /**
  * @brief The FrechetRand class <BR>
@@ -49,6 +50,29 @@ private:
 
 public:
     double Entropy() const;
+
+    /**
+     * @fn Fit
+     * fit shape, scale and location via maximum-likelihood
+     * @param sample
+     */
+    void Fit(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * fit shape, scale and location via maximum-likelihood for weighted sample
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+private:
+    /**
+     * @fn fit
+     * @param sample
+     * @param weights empty for unweighted sample
+     */
+    void fit(const std::vector<double> &sample, const std::vector<double> &weights);
 };
 
 #endif // FRECHETRAND_H
@@ -451,7 +451,7 @@ double GammaDistribution::quantileImpl(double p) const
     double guess = quantileInitialGuess(p);
     if (p < 1e-5) { /// too small p
         double logP = std::log(p);
-        if (RandMath::findRoot([this, logP] (double x)
+        if (RandMath::findRootNewtonSecondOrder([this, logP] (double x)
         {
             if (x <= 0)
                return DoubleTriplet(-INFINITY, 0, 0);
@@ -465,7 +465,7 @@ double GammaDistribution::quantileImpl(double p) const
         /// if we can't find quantile, then probably something bad has happened
         return NAN;
     }
-    if (RandMath::findRoot([this, p] (double x)
+    if (RandMath::findRootNewtonSecondOrder([this, p] (double x)
     {
         if (x <= 0)
             return DoubleTriplet(-p, 0, 0);
@@ -484,7 +484,7 @@ double GammaDistribution::quantileImpl1m(double p) const
     double guess = quantileInitialGuess1m(p);
     if (p < 1e-5) { /// too small p
         double logP = std::log(p);
-        if (RandMath::findRoot([this, logP] (double x)
+        if (RandMath::findRootNewtonSecondOrder([this, logP] (double x)
         {
            if (x <= 0)
                return DoubleTriplet(logP, 0, 0);
@@ -498,7 +498,7 @@ double GammaDistribution::quantileImpl1m(double p) const
         /// if we can't find quantile, then probably something bad has happened
         return NAN;
     }
-    if (RandMath::findRoot([this, p] (double x)
+    if (RandMath::findRootNewtonSecondOrder([this, p] (double x)
     {
         if (x <= 0)
             return DoubleTriplet(p - 1.0, 0, 0);
@@ -529,12 +529,20 @@ void FreeScaleGammaDistribution::SetScale(double scale)
 
 void FreeScaleGammaDistribution::FitRate(const std::vector<double> &sample, bool unbiased)
 {
+    /// Validation and mean are calculated in one pass
+    SufficientStatistics statistics(SufficientStatistics::MOMENTS);
+    statistics.Add(sample);
+    FitRateFromStatistics(statistics, unbiased);
+}
+
+void FreeScaleGammaDistribution::FitRateFromStatistics(const SufficientStatistics &statistics, bool unbiased)
+{
+    checkStatistics(statistics, SufficientStatistics::MOMENTS);
     /// Sanity check
-    if (!allElementsArePositive(sample))
+    if (statistics.GetMin() <= 0)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, POSITIVITY_VIOLATION));
-    double mean = GetSampleMean(sample);
-    double coef = alpha - (unbiased ? 1.0 / sample.size() : 0.0);
-    SetParameters(alpha, coef / mean);
+    double coef = alpha - (unbiased ? 1.0 / statistics.GetCount() : 0.0);
+    SetParameters(alpha, coef / statistics.GetMean());
 }
 
 GammaRand FreeScaleGammaDistribution::FitRateBayes(const std::vector<double> &sample, const GammaDistribution & priorDistribution)
@@ -558,15 +566,19 @@ String GammaRand::Name() const
 
 void GammaRand::FitShape(const std::vector<double> &sample)
 {
+    /// Validation and statistics are calculated in one pass
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    checkStatistics(statistics, SufficientStatistics::LOG_MOMENTS);
     /// Sanity check
-    if (!allElementsArePositive(sample))
+    if (statistics.GetMin() <= 0)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, POSITIVITY_VIOLATION));
 
     /// Calculate initial guess via method of moments
-    double shape = GetSampleMean(sample) * beta;
+    double shape = statistics.GetMean() * beta;
     /// Run root-finding procedure
-    double s = GetSampleLogMean(sample) + logBeta;
-    if (!RandMath::findRoot([s] (double x)
+    double s = statistics.GetLogMean() + logBeta;
+    if (!RandMath::findRootNewtonFirstOrder([s] (double x)
     {
         double first = RandMath::digamma(x) - s;
         double second = RandMath::trigamma(x);
@@ -578,20 +590,36 @@ void GammaRand::FitShape(const std::vector<double> &sample)
 
 void GammaRand::Fit(const std::vector<double> &sample)
 {
+    /// Validation and statistics are calculated in one pass
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    FitFromStatistics(statistics);
+}
+
+void GammaRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    FitFromStatistics(statistics);
+}
+
+void GammaRand::FitFromStatistics(const SufficientStatistics &statistics)
+{
+    checkStatistics(statistics, SufficientStatistics::LOG_MOMENTS);
     /// Sanity check
-    if (!allElementsArePositive(sample))
+    if (statistics.GetMin() <= 0)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, POSITIVITY_VIOLATION));
 
     /// Calculate initial guess for shape
-    double average = GetSampleLogMean(sample);
-    double s = std::log(average) - GetSampleLogMean(sample);
+    double average = statistics.GetMean();
+    double s = std::log(average) - statistics.GetLogMean();
     double sm3 = s - 3.0, sp12 = 12.0 * s;
     double shape = sm3 * sm3 + 2 * sp12;
     shape = std::sqrt(shape);
     shape -= sm3;
     shape /= sp12;
 
-    if (!RandMath::findRoot([s] (double x)
+    if (!RandMath::findRootNewtonFirstOrder([s] (double x)
     {
         double first = RandMath::digammamLog(x) + s;
         double second = RandMath::trigamma(x) - 1.0 / x;
@@ -602,6 +630,38 @@ void GammaRand::Fit(const std::vector<double> &sample)
     SetParameters(shape, shape / average);
 }
 
+std::vector<double> GammaRand::LogLikelihoodGradient(const std::vector<double> &sample) const
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    return LogLikelihoodGradientFromStatistics(statistics);
+}
+
+std::vector<double> GammaRand::LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    return LogLikelihoodGradientFromStatistics(statistics);
+}
+
+std::vector<double> GammaRand::LogLikelihoodGradientFromStatistics(const SufficientStatistics &statistics) const
+{
+    if (!statistics.HasStatistics(SufficientStatistics::MOMENTS | SufficientStatistics::LOG_MOMENTS))
+        throw std::invalid_argument("Log-likelihood gradient: statistics should contain moments and log-moments");
+    double n = statistics.GetCount();
+    if (n == 0)
+        return {0.0, 0.0};
+    /// d/dα = log(β) - ψ(α) + log(x), d/dβ = α / β - x
+    double gradShape = logBeta - RandMath::digamma(alpha) + statistics.GetLogMean();
+    double gradRate = alpha * theta - statistics.GetMean();
+    return {n * gradShape, n * gradRate};
+}
+
+std::vector<std::vector<double>> GammaRand::FisherInformation() const
+{
+    return {{RandMath::trigamma(alpha), -theta}, {-theta, alpha * theta * theta}};
+}
+
 String ChiSquaredRand::Name() const
 {
     return "Chi-squared(" + toStringWithPrecision(GetDegree()) + ")";
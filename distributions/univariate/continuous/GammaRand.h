@@ -253,6 +253,20 @@ public:
      */
     void FitRate(const std::vector<double> &sample, bool unbiased = false);
 
+    /**
+     * @fn CreateStatistics
+     * @return empty accumulator of statistics, sufficient for FitFromStatistics
+     */
+    static SufficientStatistics CreateStatistics() { return SufficientStatistics(SufficientStatistics::MOMENTS | SufficientStatistics::LOG_MOMENTS); }
+
+    /**
+     * @fn FitRateFromStatistics
+     * set rate in the same way as FitRate for the whole sample
+     * @param statistics
+     * @param unbiased
+     */
+    void FitRateFromStatistics(const SufficientStatistics &statistics, bool unbiased = false);
+
     /**
      * @fn FitRateBayes
      * set rate, returned by bayesian estimation
@@ -289,6 +303,49 @@ public:
      * @param sample
      */
     void Fit(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * set shape and rate for weighted (binned) sample
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn FitFromStatistics
+     * set shape and rate in the same way as Fit for the whole sample
+     * @param statistics
+     */
+    void FitFromStatistics(const SufficientStatistics &statistics);
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @return gradient of log-likelihood function with respect to (α, β)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample) const;
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return gradient of log-likelihood function for weighted sample with respect to (α, β)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
+
+    /**
+     * @fn LogLikelihoodGradientFromStatistics
+     * @param statistics
+     * @return the same gradient as LogLikelihoodGradient for the whole sample
+     */
+    std::vector<double> LogLikelihoodGradientFromStatistics(const SufficientStatistics &statistics) const;
+
+    /**
+     * @fn FisherInformation
+     * @return Fisher information matrix of one observation for (α, β)
+     */
+    std::vector<std::vector<double>> FisherInformation() const;
 };
 
 
@@ -183,7 +183,7 @@ double ShiftedGeometricStableDistribution::pdfByLevy(double x) const
     /// we do numerical integration in the case of c > 0.5
     // (as I wasn't able to handle complex integrals)
     double adivc = x / mu;
-    double y = RandMath::integral([this, a, c, adivc] (double t)
+    double y = RandMath::integralAdaptiveSimpson([this, a, c, adivc] (double t)
     {
         if (t <= 0 || t >= adivc)
             return 0.0;
@@ -206,7 +206,7 @@ double ShiftedGeometricStableDistribution::pdfByCauchy(double x) const
     // to split the integral on two
     if (x == 0)
         return INFINITY;
-    return -gamma * M_1_PI * RandMath::integral([this, x] (double t)
+    return -gamma * M_1_PI * RandMath::integralAdaptiveSimpson([this, x] (double t)
     {
         if (t <= 0.0 || t >= 1.0)
             return 0.0;
@@ -249,7 +249,7 @@ double ShiftedGeometricStableDistribution::f(const double & x) const
         }
     }
 
-    return RandMath::integral([this, x0] (double z)
+    return RandMath::integralAdaptiveSimpson([this, x0] (double z)
     {
         if (z <= 0 || z >= 1)
             return 0.0;
@@ -271,7 +271,7 @@ double ShiftedGeometricStableDistribution::F(const double & x) const
     double x0 = x - m;
     if (distributionType == LAPLACE || distributionType == ASYMMETRIC_LAPLACE)
         return cdfLaplace(x0);
-    return RandMath::integral([this, x0] (double z)
+    return RandMath::integralAdaptiveSimpson([this, x0] (double z)
     {
         if (z <= 0) {
             if (x0 != 0.0)
@@ -546,3 +546,73 @@ void GeometricStableRand::SetScale(double scale)
     ShiftedGeometricStableDistribution::SetScale(scale);
     ChangeAsymmetry();
 }
+
+void GeometricStableRand::FitByCharacteristicFunction(const std::vector<double> &sample)
+{
+    static constexpr int SIZE = 10;
+    static constexpr double STEP = 0.1;
+    if (sample.size() < 5)
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should contain at least 5 elements"));
+    /// Geometric-stable laws are closed under scaling, but not under shift
+    std::vector<double> quartiles = GetSampleQuantiles(sample, {0.25, 0.75});
+    double scale0 = quartiles[1] - quartiles[0];
+    if (scale0 <= 0.0)
+        throw std::runtime_error(fitErrorDescription(WRONG_RETURN, "Interquartile range should be positive"));
+    std::vector<std::complex<double>> cf = GetSampleCharacteristicFunction(sample, STEP / scale0, SIZE);
+
+    /// log(Re(1 / φ(t) - 1)) = α log(γ) + α log(t)
+    std::vector<std::complex<double>> psi(SIZE);
+    std::vector<double> logT(SIZE);
+    double n = 0, sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    for (int k = 0; k != SIZE; ++k) {
+        logT[k] = std::log(STEP * (k + 1));
+        psi[k] = 1.0 / cf[k] - 1.0;
+        if (psi[k].real() > 0.0) {
+            double y = std::log(psi[k].real());
+            ++n;
+            sumX += logT[k];
+            sumY += y;
+            sumXX += logT[k] * logT[k];
+            sumXY += logT[k] * y;
+        }
+    }
+    if (n < 2)
+        throw std::runtime_error(fitErrorDescription(WRONG_RETURN, "Empirical characteristic function is too close to 1"));
+    double slope = (n * sumXY - sumX * sumY) / (n * sumXX - sumX * sumX);
+    double exponent = std::min(std::max(slope, 0.1), 2.0);
+    double scale = std::exp((sumY - slope * sumX) / (n * exponent));
+    if (std::fabs(exponent - 1.0) < 0.01)
+        exponent = 1.0;
+
+    /// Im(1 / φ(t) - 1) = -β tan(πα / 2) (γt)^α - μt for α ≠ 1 and 2 / π βγ t log(t) - μt for α = 1,
+    /// β and μ are found by least squares without intercept
+    double a11 = 0, a12 = 0, a22 = 0, b1 = 0, b2 = 0;
+    double skewnessCoef = (exponent == 1.0) ? M_2_PI * scale : -std::pow(scale, exponent) * std::tan(M_PI_2 * exponent);
+    for (int k = 0; k != SIZE; ++k) {
+        double t = STEP * (k + 1);
+        double u = skewnessCoef * ((exponent == 1.0) ? t * logT[k] : std::exp(exponent * logT[k]));
+        double z = psi[k].imag();
+        a11 += u * u;
+        a12 -= u * t;
+        a22 += t * t;
+        b1 += u * z;
+        b2 -= t * z;
+    }
+    /// for α close to 2 skewness doesn't affect the characteristic function
+    double det = a11 * a22 - a12 * a12;
+    double skewness = 0.0, location = b2 / a22;
+    if (std::fabs(skewnessCoef) > 0.01 && det > 0.0) {
+        skewness = std::min(std::max((a22 * b1 - a12 * b2) / det, -1.0), 1.0);
+        location = (a11 * b2 - a12 * b1) / det;
+    }
+    if (exponent == 1.0 && std::fabs(skewness) < 0.01)
+        skewness = 0.0;
+
+    /// Return to the original scale: for α = 1 location gets the additional term
+    location *= scale0;
+    if (exponent == 1.0)
+        location -= M_2_PI * skewness * scale * scale0 * std::log(scale0);
+    SetParameters(exponent, skewness);
+    SetScale(scale * scale0);
+    SetLocation(location);
+}
@@ -132,6 +132,15 @@ public:
     void SetLocation(double location);
     void SetScale(double scale);
     inline double GetLocation() const { return mu; }
+
+    /**
+     * @fn FitByCharacteristicFunction
+     * fit all parameters by regression on empirical characteristic function,
+     * as 1 / φ(t) - 1 = (γt)^α (1 - iβ tan(πα / 2)) - iμt is linear in log-scale and in t.
+     * Sample is standardized by interquartile range and φ is taken in points 0.1, 0.2, ..., 1
+     * @param sample
+     */
+    void FitByCharacteristicFunction(const std::vector<double> &sample);
 };
 
 #endif // GEOMETRICSTABLERAND_H
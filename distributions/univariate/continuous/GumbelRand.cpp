@@ -109,3 +109,53 @@ double GumbelRand::Entropy() const
 {
     return logBeta + M_EULER + 1.0;
 }
+
+void GumbelRand::Fit(const std::vector<double> &sample)
+{
+    fit(sample, {});
+}
+
+void GumbelRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, "Number of weights should be equal to the sample size"));
+    fit(sample, weights);
+}
+
+void GumbelRand::fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (sample.empty())
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    /// Initial guess by method of moments
+    auto [mean, variance] = weights.empty() ? GetSampleMeanAndVariance(sample) : GetSampleMeanAndVariance(sample, weights);
+    double scale = (variance > 0) ? std::sqrt(6 * variance) / M_PI : 1.0;
+    double location = mean - M_EULER * scale;
+    std::vector<double> parameters = {location, scale};
+
+    /// Score: d/dμ = (1 - exp(-z)) / β, d/dβ = (z - 1 - z * exp(-z)) / β, where z = (x - μ) / β
+    MaximumLikelihoodFitter<double> fitter(*this, [this] (const std::vector<double> &theta)
+    {
+        SetLocation(theta[0]);
+        SetScale(theta[1]);
+    },
+    {-INFINITY, 0.0}, {INFINITY, INFINITY},
+    [this] (const std::vector<double> &data, const std::vector<double> &w)
+    {
+        double sumExp = 0, sumZ = 0, sumZExp = 0, total = 0;
+        for (size_t i = 0; i != data.size(); ++i) {
+            double weight = w.empty() ? 1.0 : w[i];
+            if (weight == 0)
+                continue;
+            double z = (data[i] - mu) / beta;
+            double expZ = std::exp(-z);
+            sumExp += weight * expZ;
+            sumZ += weight * z;
+            sumZExp += weight * z * expZ;
+            total += weight;
+        }
+        return std::vector<double>{(total - sumExp) / beta, (sumZ - total - sumZExp) / beta};
+    });
+    bool converged = weights.empty() ? fitter.Fit(sample, parameters) : fitter.Fit(sample, weights, parameters);
+    if (!converged)
+        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in optimization procedure"));
+}
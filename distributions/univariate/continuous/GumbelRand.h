@@ -2,6 +2,7 @@
 #define GUMBELRAND_H
 
 #include "ContinuousDistribution.h"
+#include "../MaximumLikelihoodFitter.h"
 
 /**
  * @brief The GumbelRand class <BR>
@@ -50,6 +51,29 @@ private:
 
 public:
     double Entropy() const;
+
+    /**
+     * @fn Fit
+     * fit location and scale via maximum-likelihood
+     * @param sample
+     */
+    void Fit(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * fit location and scale via maximum-likelihood for weighted sample
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+private:
+    /**
+     * @fn fit
+     * @param sample
+     * @param weights empty for unweighted sample
+     */
+    void fit(const std::vector<double> &sample, const std::vector<double> &weights);
 };
 
 #endif // GUMBELRAND_H
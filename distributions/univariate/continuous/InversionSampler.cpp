@@ -0,0 +1,213 @@
+#include "InversionSampler.h"
+#include "UniformRand.h"
+
+InversionSampler::InversionSampler(const ContinuousDistribution &continuousDistribution, double uError, int polynomialOrder) :
+    distribution(continuousDistribution)
+{
+    if (uError < 1e-14 || uError > 1e-4)
+        throw std::invalid_argument("Inversion sampler: u-error should be in interval [1e-14, 1e-4]");
+    if (polynomialOrder < 3 || polynomialOrder > 12)
+        throw std::invalid_argument("Inversion sampler: order of polynomials should be in interval [3, 12]");
+    uResolution = uError;
+    order = polynomialOrder;
+    Update();
+}
+
+String InversionSampler::Name() const
+{
+    return "Numerical inversion for " + distribution.Name();
+}
+
+double InversionSampler::integralGaussLobatto(double a, double b) const
+{
+    static constexpr double SQRT3DIV7 = 0.65465367070797714380;
+    static constexpr double W1 = 1.0 / 20, W2 = 49.0 / 180, W3 = 16.0 / 45;
+    double h = 0.5 * (b - a), c = a + h;
+    double sum = W1 * (distribution.f(a) + distribution.f(b));
+    sum += W2 * (distribution.f(c - SQRT3DIV7 * h) + distribution.f(c + SQRT3DIV7 * h));
+    sum += W3 * distribution.f(c);
+    return 2 * h * sum;
+}
+
+double InversionSampler::integralAdaptive(double a, double b, double whole, double tolerance, int depth, double parentError) const
+{
+    double c = 0.5 * (a + b);
+    double left = integralGaussLobatto(a, c), right = integralGaussLobatto(c, b);
+    double sum = left + right, error = std::fabs(sum - whole);
+    /// Split the interval while it improves the accuracy: if the error doesn't decrease,
+    /// then it is dominated by rounding of nodes
+    if (error <= tolerance * sum || error >= parentError || depth >= MAX_INTEGRATION_DEPTH)
+        return sum;
+    return integralAdaptive(a, c, left, tolerance, depth + 1, error) + integralAdaptive(c, b, right, tolerance, depth + 1, error);
+}
+
+double InversionSampler::integral(double a, double b) const
+{
+    /// density is nonnegative, so that relative tolerance for each part bounds the error of the whole area,
+    /// it can't be smaller than precision of double
+    double tolerance = std::max(INTEGRATION_TOLERANCE * uResolution, 1e-15);
+    return integralAdaptive(a, b, integralGaussLobatto(a, b), tolerance, 0, INFINITY);
+}
+
+bool InversionSampler::setupInterval(double a, double b, std::vector<double> &u, std::vector<double> &c) const
+{
+    /// Chebyshev points, including boundaries
+    int n = order;
+    double h = 0.5 * (b - a);
+    u[0] = 0.0;
+    c[0] = a;
+    for (int k = 1; k <= n; ++k) {
+        c[k] = (k == n) ? b : a + h * (1.0 - std::cos(k * M_PI / n));
+        u[k] = u[k - 1] + integral(c[k - 1], c[k]);
+        if (u[k] <= u[k - 1])
+            return false;
+    }
+    std::vector<double> x(c);
+
+    /// divided differences of inverse function
+    for (int j = 1; j <= n; ++j) {
+        for (int k = n; k >= j; --k)
+            c[k] = (c[k] - c[k - 1]) / (u[k] - u[k - j]);
+    }
+
+    /// u-error in the middle points between nodes and close to the boundaries,
+    /// where it is the largest if interval is next to a pole
+    double tolerance = uResolution * area;
+    auto isAccurate = [&] (int k, double t) {
+        double y = c[n];
+        for (int j = n - 1; j >= 0; --j)
+            y = c[j] + (t - u[j]) * y;
+        if (!(y > x[k] && y < x[k + 1]))
+            return false;
+        double error = u[k] + integral(x[k], y) - t;
+        return std::fabs(error) <= tolerance;
+    };
+    for (int k = 0; k != n; ++k) {
+        if (!isAccurate(k, 0.5 * (u[k] + u[k + 1])))
+            return false;
+    }
+    for (double w : {0.1, 0.01}) {
+        if (!isAccurate(0, (1 - w) * u[0] + w * u[1]) || !isAccurate(n - 1, w * u[n - 1] + (1 - w) * u[n]))
+            return false;
+    }
+    return true;
+}
+
+void InversionSampler::Update()
+{
+    /// computational domain: tails of negligible mass are cut
+    double tailMass = 0.05 * uResolution;
+    double a = distribution.Quantile(tailMass);
+    double b = distribution.Quantile1m(tailMass);
+    /// poles at the boundaries of support are excluded
+    if (!std::isfinite(distribution.f(a)))
+        a = std::nextafter(a, b);
+    if (!std::isfinite(distribution.f(b)))
+        b = std::nextafter(b, a);
+    if (!std::isfinite(a) || !std::isfinite(b) || a >= b)
+        throw std::invalid_argument("Inversion sampler: computational domain cannot be found");
+    lowerTail = distribution.F(a);
+    area = 1.0 - lowerTail - distribution.S(b);
+
+    points.clear();
+    cdf.clear();
+    nodes.clear();
+    coefs.clear();
+    std::vector<double> u(order + 1), c(order + 1);
+    double x = a, h = (b - a) / 128, sum = 0.0;
+    while (x < b) {
+        if ((int)points.size() >= MAX_INTERVALS)
+            throw std::invalid_argument("Inversion sampler: too many intervals are required, u-error should be increased");
+        h = std::min(h, b - x);
+        if (!setupInterval(x, x + h, u, c)) {
+            /// intervals are split relatively to their position, as the ones near poles can be very short
+            if (h > MIN_RELATIVE_STEP * std::fabs(x) && h > 1e-300) {
+                h *= 0.5;
+                continue;
+            }
+            /// linear interpolation, if interval is too small, e.g. at jumps of density:
+            /// its u-error is bounded by the area, which then should be below resolution
+            double length = integral(x, x + h);
+            if (length > uResolution * area)
+                throw std::invalid_argument("Inversion sampler: u-error cannot be reached, density is probably unbounded");
+            std::fill(u.begin(), u.end(), 0.0);
+            std::fill(c.begin(), c.end(), 0.0);
+            c[0] = x;
+            c[1] = (length > 0.0) ? h / length : 0.0;
+        }
+        points.push_back(x);
+        cdf.push_back(sum);
+        nodes.insert(nodes.end(), u.begin(), u.end());
+        coefs.insert(coefs.end(), c.begin(), c.end());
+        sum += (u[order] > 0.0) ? u[order] : integral(x, x + h);
+        x += h;
+        h *= 1.3;
+    }
+    points.push_back(b);
+    area = sum;
+
+    /// guide table
+    int K = cdf.size();
+    guide.resize(K);
+    int i = 0;
+    for (int j = 0; j != K; ++j) {
+        double level = area * j / K;
+        while (i < K - 1 && cdf[i + 1] <= level)
+            ++i;
+        guide[j] = i;
+    }
+}
+
+double InversionSampler::evaluate(int i, double u) const
+{
+    const double *c = coefs.data() + i * (order + 1);
+    const double *t = nodes.data() + i * (order + 1);
+    double y = c[order];
+    for (int j = order - 1; j >= 0; --j)
+        y = c[j] + (u - t[j]) * y;
+    /// polynomial shouldn't leave the interval
+    return std::max(points[i], std::min(y, points[i + 1]));
+}
+
+double InversionSampler::invert(double u) const
+{
+    int K = cdf.size();
+    int j = u / area * K;
+    int i = guide[std::max(0, std::min(j, K - 1))];
+    while (i < K - 1 && cdf[i + 1] <= u)
+        ++i;
+    return evaluate(i, u - cdf[i]);
+}
+
+double InversionSampler::Variate() const
+{
+    return invert(area * UniformRand::StandardVariate(localRandGenerator));
+}
+
+void InversionSampler::Sample(std::vector<double> &outputData) const
+{
+    for (double & var : outputData)
+        var = invert(area * UniformRand::StandardVariate(localRandGenerator));
+}
+
+double InversionSampler::Median() const
+{
+    return quantileImpl(0.5);
+}
+
+double InversionSampler::quantileImpl(double p) const
+{
+    double u = p - lowerTail;
+    /// tails are left for original distribution
+    if (u < 0.0 || u > area)
+        return distribution.Quantile(p);
+    return invert(u);
+}
+
+double InversionSampler::quantileImpl1m(double p) const
+{
+    double u = 1.0 - p - lowerTail;
+    if (u < 0.0 || u > area)
+        return distribution.Quantile1m(p);
+    return invert(u);
+}
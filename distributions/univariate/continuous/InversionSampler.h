@@ -0,0 +1,137 @@
+#ifndef INVERSIONSAMPLER_H
+#define INVERSIONSAMPLER_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The InversionSampler class <BR>
+ * Wrapper for any continuous distribution with bounded density,
+ * which generates variates and calculates quantiles by fast numerical inversion
+ *
+ * Polynomial interpolation of inverse cdf (PINV) by W. Hörmann and J. Leydold:
+ * the domain is split into intervals, where inverse cdf is approximated by
+ * Newton's interpolating polynomial, cdf is calculated from f by adaptive Gauss-Lobatto quadrature
+ * and u-error is checked in the test points. Generation of variate costs one uniform
+ * variate, guide table lookup and evaluation of polynomial.
+ * Tables should be updated after parameters of original distribution are changed.
+ * Original distribution is stored by reference and should outlive the sampler,
+ * hence temporary distributions are not accepted.
+ */
+class RANDLIBSHARED_EXPORT InversionSampler : public ContinuousDistribution
+{
+    const ContinuousDistribution &distribution; ///< original distribution
+    double uResolution = 1e-10; ///< maximal tolerated u-error
+    int order = 5; ///< order of interpolating polynomials
+
+    /// maximal number of intervals
+    static constexpr int MAX_INTERVALS = 10000;
+    /// minimal length of interval relatively to its position
+    static constexpr double MIN_RELATIVE_STEP = 1e-13;
+    /// maximal depth of bisection in adaptive quadrature, large as bisection towards poles is long
+    static constexpr int MAX_INTEGRATION_DEPTH = 1100;
+    /// tolerated relative error of quadrature in units of u-resolution
+    static constexpr double INTEGRATION_TOLERANCE = 0.05;
+
+    std::vector<double> points{}; ///< left boundaries of intervals and right boundary of the last one
+    std::vector<double> cdf{}; ///< areas below density on the left from each interval
+    std::vector<double> nodes{}; ///< relative u-nodes of interpolation, (order + 1) for each interval
+    std::vector<double> coefs{}; ///< coefficients of Newton's polynomials, (order + 1) for each interval
+    std::vector<int> guide{}; ///< guide table for the intervals
+    double lowerTail = 0; ///< F(points[0])
+    double area = 1; ///< area below density in the computational domain
+
+public:
+    InversionSampler(const ContinuousDistribution &continuousDistribution, double uError = 1e-10, int polynomialOrder = 5);
+    InversionSampler(const ContinuousDistribution &&continuousDistribution, double uError = 1e-10, int polynomialOrder = 5) = delete;
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override { return distribution.SupportType(); }
+    double MinValue() const override { return distribution.MinValue(); }
+    double MaxValue() const override { return distribution.MaxValue(); }
+
+    /**
+     * @fn Update
+     * rebuild tables for current parameters of the original distribution
+     */
+    void Update();
+
+    /**
+     * @fn GetNumberOfIntervals
+     * @return number of intervals with interpolating polynomials
+     */
+    inline int GetNumberOfIntervals() const { return points.size() - 1; }
+
+    double f(const double & x) const override { return distribution.f(x); }
+    double logf(const double & x) const override { return distribution.logf(x); }
+    double F(const double & x) const override { return distribution.F(x); }
+    double S(const double & x) const override { return distribution.S(x); }
+    double Variate() const override;
+    void Sample(std::vector<double> &outputData) const override;
+
+    double Mean() const override { return distribution.Mean(); }
+    double Variance() const override { return distribution.Variance(); }
+    double Median() const override;
+    double Mode() const override { return distribution.Mode(); }
+    double Skewness() const override { return distribution.Skewness(); }
+    double ExcessKurtosis() const override { return distribution.ExcessKurtosis(); }
+
+private:
+    /**
+     * @fn integralGaussLobatto
+     * @param a
+     * @param b
+     * @return integral of density from a to b by 5-point Gauss-Lobatto quadrature
+     */
+    double integralGaussLobatto(double a, double b) const;
+
+    /**
+     * @fn integralAdaptive
+     * @param a
+     * @param b
+     * @param whole integral from a to b by 5-point Gauss-Lobatto quadrature
+     * @param tolerance relative tolerance
+     * @param depth depth of bisection
+     * @param parentError error estimate for the interval, which was bisected
+     * @return integral of density from a to b, where the error of Gauss-Lobatto quadrature
+     * is estimated by comparison with the one on two halves of interval, which are split further if needed
+     */
+    double integralAdaptive(double a, double b, double whole, double tolerance, int depth, double parentError) const;
+
+    /**
+     * @fn integral
+     * @param a
+     * @param b
+     * @return integral of density from a to b by adaptive Gauss-Lobatto quadrature
+     */
+    double integral(double a, double b) const;
+
+    /**
+     * @fn setupInterval
+     * @param a left boundary
+     * @param b right boundary
+     * @param u output: relative u-nodes of interpolation
+     * @param c output: coefficients of Newton's polynomial
+     * @return true if u-error is smaller than resolution
+     */
+    bool setupInterval(double a, double b, std::vector<double> &u, std::vector<double> &c) const;
+
+    /**
+     * @fn evaluate
+     * @param i index of interval
+     * @param u area on the left of the point in the interval
+     * @return value of interpolating polynomial
+     */
+    double evaluate(int i, double u) const;
+
+    /**
+     * @fn invert
+     * @param u area on the left of the point in computational domain
+     * @return approximation of inverse cdf
+     */
+    double invert(double u) const;
+
+    double quantileImpl(double p) const override;
+    double quantileImpl1m(double p) const override;
+    std::complex<double> CFImpl(double t) const override { return distribution.CF(t); }
+};
+
+#endif // INVERSIONSAMPLER_H
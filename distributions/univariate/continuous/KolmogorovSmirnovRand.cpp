@@ -200,7 +200,7 @@ double KolmogorovSmirnovRand::quantileImpl(double p) const
     double guess = std::sqrt(-0.5 * (std::log1p(-p) - M_LN2));
     if (p < 1e-5) {
         double logP = std::log(p);
-        if (RandMath::findRoot([this, logP] (double x)
+        if (RandMath::findRootNewtonFirstOrder([this, logP] (double x)
         {
             double logCdf = logF(x), logPdf = logf(x);
             double first = logCdf - logP;
@@ -210,7 +210,7 @@ double KolmogorovSmirnovRand::quantileImpl(double p) const
             return guess;
         return NAN;
     }
-    if (RandMath::findRoot([p, this] (double x)
+    if (RandMath::findRootNewtonFirstOrder([p, this] (double x)
     {
         double first = F(x) - p;
         double second = f(x);
@@ -225,7 +225,7 @@ double KolmogorovSmirnovRand::quantileImpl1m(double p) const
     double guess = std::sqrt(-0.5 * std::log(0.5 * p));
     if (p < 1e-5) {
         double logP = std::log(p);
-        if (RandMath::findRoot([this, logP] (double x)
+        if (RandMath::findRootNewtonFirstOrder([this, logP] (double x)
         {
             double logCcdf = logS(x), logPdf = logf(x);
             double first = logP - logCcdf;
@@ -235,7 +235,7 @@ double KolmogorovSmirnovRand::quantileImpl1m(double p) const
             return guess;
         return NAN;
     }
-    if (RandMath::findRoot([p, this] (double x)
+    if (RandMath::findRootNewtonFirstOrder([p, this] (double x)
     {
         double first = p - S(x);
         double second = f(x);
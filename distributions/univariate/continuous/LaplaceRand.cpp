@@ -87,27 +87,23 @@ double AsymmetricLaplaceDistribution::Entropy() const
 
 void AsymmetricLaplaceDistribution::FitShift(const std::vector<double> &sample)
 {
-    /// Calculate median (considering asymmetry)
-    /// we use root-finding algorithm for median search
-    double minVar = *std::min_element(sample.begin(), sample.end());
-    double maxVar = *std::max_element(sample.begin(), sample.end());
-    double median = 0.5 * (minVar + maxVar);
-
-    if (!RandMath::findRoot([this, sample] (double med)
-    {
-        double y = 0.0;
-        for (const double & x : sample) {
-            if (x > med)
-                y -= kappaSq;
-            else if (x < med)
-                ++y;
-        }
-        return y;
-    },
-    minVar, maxVar, median
-    ))
-        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in root-finding procedure"));
-
+    /// Calculate median (considering asymmetry):
+    /// #{x < m} - κ^2 #{x > m} changes sign at the k-th order statistic, where k = nκ^2 / (1 + κ^2),
+    /// hence it is found by one selection pass
+    if (sample.empty())
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    size_t n = sample.size();
+    double k = n * kappaSq / (1.0 + kappaSq);
+    size_t index = std::min(static_cast<size_t>(std::ceil(k)), n);
+    index = std::max<size_t>(index, 1) - 1;
+    std::vector<double> orderStatistic(sample);
+    std::nth_element(orderStatistic.begin(), orderStatistic.begin() + index, orderStatistic.end());
+    double median = orderStatistic[index];
+    if (k == index + 1 && index + 1 < n) {
+        /// any point between two order statistics is a root, we take the middle one
+        double next = *std::min_element(orderStatistic.begin() + index + 1, orderStatistic.end());
+        median = 0.5 * (median + next);
+    }
     SetShift(median);
 }
 
@@ -178,7 +174,7 @@ void AsymmetricLaplaceRand::FitAsymmetry(const std::vector<double> &sample)
         maxBound = 1.0;
     }
 
-    if (!RandMath::findRoot([sample, xPlus, xMinus, gammaN] (double t)
+    if (!RandMath::findRootBrent([xPlus, xMinus, gammaN] (double t)
     {
         double tSq = t * t;
         double y = 1.0 - tSq;
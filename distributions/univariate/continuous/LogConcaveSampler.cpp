@@ -0,0 +1,236 @@
+#include "LogConcaveSampler.h"
+#include "UniformRand.h"
+#include <limits>
+
+LogConcaveSampler::LogConcaveSampler(const ContinuousDistribution &distribution, double ratio) :
+    logDensity([density = &distribution] (double t) { return density->logf(t); })
+{
+    if (ratio <= 0.0 || ratio >= 1.0)
+        throw std::invalid_argument("Log-concave sampler: ratio should be in interval (0, 1)");
+    rho = ratio;
+    a = distribution.MinValue();
+    b = distribution.MaxValue();
+    double scale = std::sqrt(distribution.Variance());
+    if (!std::isfinite(scale) || scale <= 0.0)
+        scale = 1.0;
+    setup(distribution.Mode(), scale);
+}
+
+LogConcaveSampler::LogConcaveSampler(const std::function<double (double)> &logDensityFunction, double minValue, double maxValue,
+                                     double center, double scale, double ratio) :
+    logDensity(logDensityFunction)
+{
+    if (minValue >= maxValue)
+        throw std::invalid_argument("Log-concave sampler: lower boundary of support should be smaller than upper one");
+    if (scale <= 0.0)
+        throw std::invalid_argument("Log-concave sampler: scale should be positive");
+    if (ratio <= 0.0 || ratio >= 1.0)
+        throw std::invalid_argument("Log-concave sampler: ratio should be in interval (0, 1)");
+    rho = ratio;
+    a = minValue;
+    b = maxValue;
+    setup(center, scale);
+}
+
+double LogConcaveSampler::derivative(double point, double value) const
+{
+    double h = std::max(step, 64 * std::numeric_limits<double>::epsilon() * std::fabs(point));
+    if (point - h > a && point + h < b)
+        return 0.5 * (logDensity(point + h) - logDensity(point - h)) / h;
+    if (point + h < b)
+        return (logDensity(point + h) - logShift - value) / h;
+    return (value + logShift - logDensity(point - h)) / h;
+}
+
+void LogConcaveSampler::addPoint(double point)
+{
+    auto it = std::lower_bound(x.begin(), x.end(), point);
+    if (it != x.end() && *it == point)
+        return;
+    double value = logDensity(point) - logShift;
+    if (!std::isfinite(value))
+        throw std::invalid_argument("Log-concave sampler: log-density should be finite inside of support");
+    int i = it - x.begin();
+    x.insert(it, point);
+    y.insert(y.begin() + i, value);
+    d.insert(d.begin() + i, derivative(point, value));
+}
+
+double LogConcaveSampler::expIntegral(double x0, double y0, double d0, double l, double r)
+{
+    if (l >= r)
+        return 0.0;
+    double width = r - l;
+    if (std::fabs(d0) * width < 1e-10)
+        return std::exp(y0 + d0 * (0.5 * (l + r) - x0)) * width;
+    /// exp(-inf) = 0, hence infinite boundaries are fine for decaying tails
+    if (d0 > 0)
+        return std::exp(y0 + d0 * (r - x0)) * -std::expm1(-d0 * width) / d0;
+    return std::exp(y0 + d0 * (l - x0)) * std::expm1(d0 * width) / d0;
+}
+
+void LogConcaveSampler::updateHat()
+{
+    int n = x.size();
+    z.resize(n + 1);
+    z[0] = a;
+    z[n] = b;
+    for (int k = 1; k < n; ++k) {
+        double width = x[k] - x[k - 1];
+        double dd = d[k - 1] - d[k];
+        if (dd < -1e-5 * (std::fabs(d[k - 1]) + std::fabs(d[k]) + 1.0 / width))
+            throw std::invalid_argument("Log-concave sampler: density should be log-concave");
+        if (dd > 1e-12 * (std::fabs(d[k - 1]) + std::fabs(d[k]))) {
+            double t = x[k - 1] + (y[k] - y[k - 1] - d[k] * width) / dd;
+            z[k] = std::max(x[k - 1], std::min(t, x[k]));
+        }
+        else
+            z[k] = 0.5 * (x[k - 1] + x[k]);
+    }
+    cumArea.resize(n + 1);
+    cumArea[0] = 0.0;
+    for (int k = 0; k != n; ++k)
+        cumArea[k + 1] = cumArea[k] + expIntegral(x[k], y[k], d[k], z[k], z[k + 1]);
+}
+
+double LogConcaveSampler::gapLoss(int i) const
+{
+    int n = x.size();
+    if (i == 0)
+        return expIntegral(x[0], y[0], d[0], a, x[0]);
+    if (i == n)
+        return expIntegral(x[n - 1], y[n - 1], d[n - 1], x[n - 1], b);
+    double hat = expIntegral(x[i - 1], y[i - 1], d[i - 1], x[i - 1], z[i]);
+    hat += expIntegral(x[i], y[i], d[i], z[i], x[i]);
+    double slope = (y[i] - y[i - 1]) / (x[i] - x[i - 1]);
+    double squeezeArea = expIntegral(x[i - 1], y[i - 1], slope, x[i - 1], x[i]);
+    return std::max(hat - squeezeArea, 0.0);
+}
+
+void LogConcaveSampler::setup(double center, double scale)
+{
+    if (!(center >= a && center <= b))
+        throw std::invalid_argument("Log-concave sampler: starting point should be inside of support");
+    /// move starting point from the boundaries
+    if (center == a)
+        center = a + 0.5 * std::min(scale, b - a);
+    else if (center == b)
+        center = b - 0.5 * std::min(scale, b - a);
+    logShift = logDensity(center);
+    if (!std::isfinite(logShift))
+        throw std::invalid_argument("Log-concave sampler: log-density should be finite in starting point");
+    step = 1e-6 * scale;
+
+    x.clear();
+    y.clear();
+    d.clear();
+    addPoint(center);
+    addPoint((center - scale > a) ? center - scale : 0.5 * (a + center));
+    addPoint((center + scale < b) ? center + scale : 0.5 * (center + b));
+
+    /// hat should be integrable in infinite tails
+    double shift = scale;
+    for (int iter = 0; a == -INFINITY && d.front() <= 0.0; ++iter) {
+        if (iter == 64)
+            throw std::invalid_argument("Log-concave sampler: hat cannot be built for the left tail");
+        addPoint(x.front() - shift);
+        shift *= 2;
+    }
+    shift = scale;
+    for (int iter = 0; b == INFINITY && d.back() >= 0.0; ++iter) {
+        if (iter == 64)
+            throw std::invalid_argument("Log-concave sampler: hat cannot be built for the right tail");
+        addPoint(x.back() + shift);
+        shift *= 2;
+    }
+
+    /// add construction points in the gaps with the largest difference of hat and squeeze
+    updateHat();
+    while ((int)x.size() < MAX_POINTS) {
+        int n = x.size();
+        double totalLoss = 0.0, maxLoss = -1.0;
+        int worstGap = 0;
+        for (int i = 0; i <= n; ++i) {
+            double loss = gapLoss(i);
+            totalLoss += loss;
+            if (loss > maxLoss) {
+                maxLoss = loss;
+                worstGap = i;
+            }
+        }
+        if (totalLoss <= (1.0 - rho) * cumArea.back())
+            break;
+        double point;
+        if (worstGap == 0)
+            point = (a == -INFINITY) ? x[0] - 1.0 / d[0] : 0.5 * (a + x[0]);
+        else if (worstGap == n)
+            point = (b == INFINITY) ? x[n - 1] - 1.0 / d[n - 1] : 0.5 * (x[n - 1] + b);
+        else {
+            point = z[worstGap];
+            double left = x[worstGap - 1], right = x[worstGap];
+            if (point <= left || point >= right)
+                point = 0.5 * (left + right);
+            if (point <= left || point >= right)
+                break; /// gap cannot be split anymore
+        }
+        addPoint(point);
+        updateHat();
+    }
+}
+
+double LogConcaveSampler::GetRatio() const
+{
+    double totalLoss = 0.0;
+    for (int i = 0; i <= (int)x.size(); ++i)
+        totalLoss += gapLoss(i);
+    return 1.0 - totalLoss / cumArea.back();
+}
+
+double LogConcaveSampler::squeeze(double t, int i) const
+{
+    int n = x.size();
+    int j = (t >= x[i]) ? i : i - 1;
+    if (j < 0 || j + 1 >= n)
+        return 0.0;
+    double slope = (y[j + 1] - y[j]) / (x[j + 1] - x[j]);
+    return std::exp(y[j] + slope * (t - x[j]));
+}
+
+double LogConcaveSampler::Variate() const
+{
+    int n = x.size();
+    double totalArea = cumArea.back();
+    int iter = 0;
+    do {
+        double area = UniformRand::StandardVariate(localRandGenerator) * totalArea;
+        int i = std::upper_bound(cumArea.begin() + 1, cumArea.end(), area) - cumArea.begin() - 1;
+        i = std::min(i, n - 1);
+        area -= cumArea[i];
+        /// invert cdf of the hat segment from its finite boundary
+        double t;
+        if (z[i] > -INFINITY) {
+            double w = area * std::exp(-y[i] - d[i] * (z[i] - x[i]));
+            t = (d[i] == 0.0) ? z[i] + w : z[i] + std::log1p(d[i] * w) / d[i];
+        }
+        else {
+            double w = (cumArea[i + 1] - cumArea[i] - area) * std::exp(-y[i] - d[i] * (z[i + 1] - x[i]));
+            t = z[i + 1] + std::log1p(-d[i] * w) / d[i];
+        }
+        t = std::max(z[i], std::min(t, z[i + 1]));
+        double v = UniformRand::StandardVariate(localRandGenerator) * std::exp(y[i] + d[i] * (t - x[i]));
+        if (v <= squeeze(t, i) || v <= std::exp(logDensity(t) - logShift))
+            return t;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return NAN; /// shouldn't end up here
+}
+
+void LogConcaveSampler::Sample(std::vector<double> &outputData) const
+{
+    for (double & var : outputData)
+        var = Variate();
+}
+
+void LogConcaveSampler::Reseed(unsigned long seed) const
+{
+    localRandGenerator.Reseed(seed);
+}
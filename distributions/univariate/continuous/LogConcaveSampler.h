@@ -0,0 +1,138 @@
+#ifndef LOGCONCAVESAMPLER_H
+#define LOGCONCAVESAMPLER_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The LogConcaveSampler class <BR>
+ * Generator of variates from any log-concave density,
+ * given by its logarithm up to additive constant
+ *
+ * Transformed density rejection with T = log (W. Hörmann):
+ * the hat is built from tangents of log-density and the squeeze from its secants.
+ * Construction points are added on setup until the ratio of squeeze and hat areas
+ * reaches the given value, thus the expected number of iterations is close to 1
+ * and most of the variates are accepted without evaluation of the density.
+ * Derivatives are calculated numerically.
+ * If the sampler is built for a distribution, its log-density is evaluated in rejection, so that it should outlive the sampler,
+ * hence temporary distributions are not accepted.
+ */
+class RANDLIBSHARED_EXPORT LogConcaveSampler
+{
+    std::function<double (double)> logDensity; ///< log-density up to additive constant, keeps pointer to distribution if any
+    double a = -INFINITY; ///< lower boundary of support
+    double b = INFINITY; ///< upper boundary of support
+    double rho = 0.99; ///< required ratio of squeeze and hat areas
+
+    /// maximal number of construction points
+    static constexpr int MAX_POINTS = 100;
+    /// maximal number of iterations in rejection
+    static constexpr int MAX_ITER_REJECTION = 1000;
+
+    std::vector<double> x{}; ///< construction points
+    std::vector<double> y{}; ///< log-density in construction points, shifted by logShift
+    std::vector<double> d{}; ///< derivatives of log-density in construction points
+    std::vector<double> z{}; ///< boundaries of hat segments: intersections of tangents and support boundaries
+    std::vector<double> cumArea{}; ///< cumulative areas below hat segments
+    double logShift = 0; ///< log-density in the starting point
+    double step = 1e-6; ///< step of numerical differentiation
+
+    mutable RandGenerator localRandGenerator{};
+
+public:
+    /**
+     * @fn LogConcaveSampler
+     * @param distribution distribution with log-concave density
+     * @param ratio required ratio of squeeze and hat areas
+     */
+    explicit LogConcaveSampler(const ContinuousDistribution &distribution, double ratio = 0.99);
+    explicit LogConcaveSampler(const ContinuousDistribution &&distribution, double ratio = 0.99) = delete;
+
+    /**
+     * @fn LogConcaveSampler
+     * @param logDensityFunction log-concave density up to additive constant
+     * @param minValue lower boundary of support
+     * @param maxValue upper boundary of support
+     * @param center point inside of support, where log-density is finite (mode is the best choice)
+     * @param scale rough scale of distribution
+     * @param ratio required ratio of squeeze and hat areas
+     */
+    LogConcaveSampler(const std::function<double (double)> &logDensityFunction, double minValue, double maxValue,
+                      double center, double scale = 1.0, double ratio = 0.99);
+
+    /**
+     * @fn GetNumberOfPoints
+     * @return number of construction points
+     */
+    inline int GetNumberOfPoints() const { return x.size(); }
+
+    /**
+     * @fn GetRatio
+     * @return ratio of squeeze and hat areas, i.e. lower bound of acceptance probability
+     * without evaluation of density
+     */
+    double GetRatio() const;
+
+    double Variate() const;
+    void Sample(std::vector<double> &outputData) const;
+
+    /**
+     * @brief Reseed
+     * @param seed
+     */
+    void Reseed(unsigned long seed) const;
+
+private:
+    /**
+     * @fn setup
+     * build hat and squeeze, starting from points around center
+     * @param center
+     * @param scale
+     */
+    void setup(double center, double scale);
+
+    /**
+     * @fn derivative
+     * @param point
+     * @param value log-density in point
+     * @return numerical derivative of log-density
+     */
+    double derivative(double point, double value) const;
+
+    /**
+     * @fn addPoint
+     * insert construction point, keeping them sorted
+     * @param point
+     */
+    void addPoint(double point);
+
+    /**
+     * @fn updateHat
+     * calculate intersections of tangents and areas below hat
+     */
+    void updateHat();
+
+    /**
+     * @fn expIntegral
+     * @return integral of exp(y0 + d0 * (t - x0)) for t from l to r
+     */
+    static double expIntegral(double x0, double y0, double d0, double l, double r);
+
+    /**
+     * @fn gapLoss
+     * @param i index of gap between construction points:
+     * 0 for left tail, size of x for right tail
+     * @return difference of hat and squeeze areas in the gap
+     */
+    double gapLoss(int i) const;
+
+    /**
+     * @fn squeeze
+     * @param t
+     * @param i index of hat segment which contains t
+     * @return value of squeeze in t
+     */
+    double squeeze(double t, int i) const;
+};
+
+#endif // LOGCONCAVESAMPLER_H
@@ -112,40 +112,50 @@ double LogNormalRand::ExcessKurtosis() const
 
 void LogNormalRand::FitLocation(const std::vector<double> &sample)
 {
+    /// Validation and statistics are calculated in one pass
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    checkStatistics(statistics, SufficientStatistics::LOG_MOMENTS);
     /// Sanity check
-    if (!allElementsArePositive(sample))
+    if (statistics.GetMin() <= 0)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, POSITIVITY_VIOLATION));
-    SetLocation(GetSampleLogMean(sample));
+    SetLocation(statistics.GetLogMean());
 }
 
 void LogNormalRand::FitScale(const std::vector<double> &sample)
 {
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    checkStatistics(statistics, SufficientStatistics::LOG_MOMENTS);
     /// Sanity check
-    if (!allElementsArePositive(sample))
+    if (statistics.GetMin() <= 0)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, POSITIVITY_VIOLATION));
-    double mu = X.GetLocation();
-    SetScale(std::sqrt(GetSampleLogVariance(sample, mu)));
+    double shift = statistics.GetLogMean() - X.GetLocation();
+    SetScale(std::sqrt(statistics.GetLogVariance() + shift * shift));
 }
 
 void LogNormalRand::Fit(const std::vector<double> &sample)
 {
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    FitFromStatistics(statistics);
+}
+
+void LogNormalRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    FitFromStatistics(statistics);
+}
+
+void LogNormalRand::FitFromStatistics(const SufficientStatistics &statistics)
+{
+    checkStatistics(statistics, SufficientStatistics::LOG_MOMENTS);
     /// Sanity check
-    if (!allElementsArePositive(sample))
+    if (statistics.GetMin() <= 0)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, POSITIVITY_VIOLATION));
-    size_t n = sample.size();
-    long double logMean = 0.0L;
-    long double logSqDev = 0.0L;
-    for (double var : sample) {
-        double logVar = std::log(var);
-        logMean += logVar;
-        logSqDev += logVar * logVar;
-    }
-    logMean /= n;
-    logSqDev /= n;
-    logSqDev -= logMean * logMean;
-
-    SetLocation(logMean);
-    SetScale(std::sqrt(logSqDev));
+    SetLocation(statistics.GetLogMean());
+    SetScale(std::sqrt(statistics.GetLogVariance()));
 }
 
 NormalRand LogNormalRand::FitLocationBayes(const std::vector<double> &sample, const NormalRand &priorDistribution)
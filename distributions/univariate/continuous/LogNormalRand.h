@@ -57,6 +57,11 @@ public:
     void FitLocation(const std::vector<double> &sample);
     void FitScale(const std::vector<double> &sample);
     void Fit(const std::vector<double> &sample);
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /// Estimation by sufficient statistics
+    static SufficientStatistics CreateStatistics() { return SufficientStatistics(SufficientStatistics::MOMENTS | SufficientStatistics::LOG_MOMENTS); }
+    void FitFromStatistics(const SufficientStatistics &statistics);
 
     /// Bayesian estimation
     NormalRand FitLocationBayes(const std::vector<double> &sample, const NormalRand &priorDistribution);
@@ -118,22 +118,60 @@ double LogisticRand::ExcessKurtosis() const
 
 void LogisticRand::FitLocation(const std::vector<double> &sample)
 {
-    double nHalf = 0.5 * sample.size();
+    if (sample.empty())
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    /// Likelihood equation Σ 1 / (1 + exp((m - x_i) / s)) = n / 2 is solved for t = (m - c) / s,
+    /// where c is the sample mean. Exponents exp((c - x_i) / s) are calculated once,
+    /// so that each iteration takes only multiplications and divisions
+    size_t n = sample.size();
+    double center = GetSampleMean(sample);
+    std::vector<double> u(n);
+    for (size_t i = 0; i != n; ++i)
+        u[i] = std::exp((center - sample[i]) / s);
+    double nInv = 1.0 / n;
     double root = 0;
-    if (!RandMath::findRoot([this, sample, nHalf](double m)
+    if (!RandMath::findRootNewtonFirstOrder([&u, nInv] (double t)
     {
-        double f1 = 0, f2 = 0;
-        for (const double & x : sample)
-        {
-            double aux = std::exp((m - x) / s);
-            double denom = 1.0 + aux;
-            f1 += 1.0 / denom;
-            denom *= denom;
-            f2 -= aux / denom;
+        double a = std::exp(t), f1 = 0, f2 = 0;
+        for (const double & var : u) {
+            double p = 1.0 / (1.0 + a * var);
+            f1 += p;
+            f2 -= p * (1.0 - p);
         }
-        f1 -= nHalf;
-        return DoublePair(f1, f2);
+        return DoublePair(f1 * nInv - 0.5, f2 * nInv);
     }, root))
         throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in root-finding procedure"));
-    SetLocation(root);
+    SetLocation(center + s * root);
+}
+
+std::vector<double> LogisticRand::LogLikelihoodGradient(const std::vector<double> &sample) const
+{
+    return logLikelihoodGradient(sample, {});
+}
+
+std::vector<double> LogisticRand::LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Log-likelihood gradient: number of weights should be equal to the sample size");
+    return logLikelihoodGradient(sample, weights);
+}
+
+std::vector<double> LogisticRand::logLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    /// d/dμ = tanh(z / 2) / s, d/ds = (z tanh(z / 2) - 1) / s, where z = (x - μ) / s
+    double sInv = 1.0 / s;
+    auto [total, sumTanh, sumZTanh] = sumOverSample<3>(sample, weights, [this, sInv] (double x)
+    {
+        double z = (x - mu) * sInv;
+        double th = std::tanh(0.5 * z);
+        return std::array<double, 3>{1.0, th, z * th};
+    });
+    return {sumTanh * sInv, (sumZTanh - total) * sInv};
+}
+
+std::vector<std::vector<double>> LogisticRand::FisherInformation() const
+{
+    double sInvSq = 1.0 / (s * s);
+    double scaleInfo = (M_PI_SQ + 3.0) / 9.0 * sInvSq;
+    return {{sInvSq / 3.0, 0.0}, {0.0, scaleInfo}};
 }
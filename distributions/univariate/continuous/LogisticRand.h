@@ -59,6 +59,36 @@ public:
      * @param sample
      */
     void FitLocation(const std::vector<double> &sample);
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @return gradient of log-likelihood function with respect to (μ, s)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample) const;
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return gradient of log-likelihood function for weighted sample with respect to (μ, s)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
+
+    /**
+     * @fn FisherInformation
+     * @return Fisher information matrix of one observation for (μ, s)
+     */
+    std::vector<std::vector<double>> FisherInformation() const;
+
+private:
+    /**
+     * @fn logLikelihoodGradient
+     * @param sample
+     * @param weights empty for unweighted sample
+     * @return gradient of log-likelihood function with respect to (μ, s)
+     */
+    std::vector<double> logLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
 };
 
 #endif // LOGISTICRAND_H
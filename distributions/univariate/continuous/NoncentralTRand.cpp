@@ -349,7 +349,7 @@ double NoncentralTRand::Mode() const
     double right = std::sqrt(nu / (nu + 1.0)); /// right boundary for mode / μ
     double guess = 0.5 * mu * (left + right);
     double root = 0;
-    RandMath::findMin([this] (double x)
+    RandMath::findMinBrent([this] (double x)
     {
         return -f(x);
     }, guess, root);
@@ -400,7 +400,7 @@ double NoncentralTRand::quantileImpl(double p) const
     guess += mu;
     guess /= 1 - 0.25 * nu;
     double logP = std::log(p);
-    if (RandMath::findRoot([this, logP] (double x)
+    if (RandMath::findRootNewtonFirstOrder([this, logP] (double x)
     {
         double logCdf = std::log(F(x)), logPdf = logf(x);
         double first = logCdf - logP;
@@ -421,7 +421,7 @@ double NoncentralTRand::quantileImpl1m(double p) const
     guess += mu;
     guess /= 1 - 0.25 * nu;
     double logP = std::log(p);
-    if (RandMath::findRoot([this, logP] (double x)
+    if (RandMath::findRootNewtonFirstOrder([this, logP] (double x)
     {
         double logCcdf = std::log(S(x)), logPdf = logf(x);
         double first = logP - logCcdf;
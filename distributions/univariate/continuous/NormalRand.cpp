@@ -50,7 +50,7 @@ void NormalRand::SetVariance(double var)
 {
     if (var <= 0.0)
         throw std::invalid_argument("Variance of Normal distribution should be positive");
-    SetScale(var);
+    SetScale(std::sqrt(var));
 }
 
 double NormalRand::f(const double & x) const
@@ -217,6 +217,61 @@ void NormalRand::Fit(const std::vector<double> &sample, bool unbiased)
     SetVariance(stats.second * adjustment);
 }
 
+void NormalRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights, bool unbiased)
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    FitFromStatistics(statistics, unbiased);
+}
+
+void NormalRand::FitFromStatistics(const SufficientStatistics &statistics, bool unbiased)
+{
+    checkStatistics(statistics, SufficientStatistics::MOMENTS);
+    double adjustment = 1.0;
+    if (unbiased == true) {
+        double n = statistics.GetCount();
+        if (n <= 1)
+            throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "There should be at least 2 elements"));
+        adjustment = n / (n - 1);
+    }
+    SetLocation(statistics.GetMean());
+    SetVariance(statistics.GetVariance() * adjustment);
+}
+
+std::vector<double> NormalRand::LogLikelihoodGradient(const std::vector<double> &sample) const
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample);
+    return LogLikelihoodGradientFromStatistics(statistics);
+}
+
+std::vector<double> NormalRand::LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    return LogLikelihoodGradientFromStatistics(statistics);
+}
+
+std::vector<double> NormalRand::LogLikelihoodGradientFromStatistics(const SufficientStatistics &statistics) const
+{
+    if (!statistics.HasStatistics(SufficientStatistics::MOMENTS))
+        throw std::invalid_argument("Log-likelihood gradient: statistics should contain moments");
+    /// Σ (x - μ) = n (m - μ), Σ (x - μ)^2 = n (s^2 + (m - μ)^2)
+    double n = statistics.GetCount();
+    if (n == 0)
+        return {0.0, 0.0};
+    double deviation = statistics.GetMean() - mu;
+    double precision = GetPrecision();
+    double sumSq = n * (statistics.GetVariance() + deviation * deviation);
+    return {n * deviation * precision, (sumSq * precision - n) / sigma};
+}
+
+std::vector<std::vector<double>> NormalRand::FisherInformation() const
+{
+    double precision = GetPrecision();
+    return {{precision, 0.0}, {0.0, 2.0 * precision}};
+}
+
 void NormalRand::Fit(const std::vector<double> &sample, DoublePair &confidenceIntervalForMean, DoublePair &confidenceIntervalForVariance, double significanceLevel, bool unbiased)
 {
     if (significanceLevel <= 0 || significanceLevel > 1)
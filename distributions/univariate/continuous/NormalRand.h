@@ -119,6 +119,57 @@ public:
      */
     void Fit(const std::vector<double> &sample, bool unbiased = false);
 
+    /**
+     * @fn Fit
+     * set parameters for weighted (binned) sample in the same way
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @param unbiased
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights, bool unbiased = false);
+
+    /**
+     * @fn CreateStatistics
+     * @return empty accumulator of statistics, sufficient for FitFromStatistics
+     */
+    static SufficientStatistics CreateStatistics() { return SufficientStatistics(SufficientStatistics::MOMENTS); }
+
+    /**
+     * @fn FitFromStatistics
+     * set parameters in the same way as Fit for the whole sample
+     * @param statistics
+     * @param unbiased
+     */
+    void FitFromStatistics(const SufficientStatistics &statistics, bool unbiased = false);
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @return gradient of log-likelihood function with respect to (μ, σ)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample) const;
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return gradient of log-likelihood function for weighted sample with respect to (μ, σ)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
+
+    /**
+     * @fn LogLikelihoodGradientFromStatistics
+     * @param statistics
+     * @return the same gradient as LogLikelihoodGradient for the whole sample
+     */
+    std::vector<double> LogLikelihoodGradientFromStatistics(const SufficientStatistics &statistics) const;
+
+    /**
+     * @fn FisherInformation
+     * @return Fisher information matrix of one observation for (μ, σ)
+     */
+    std::vector<std::vector<double>> FisherInformation() const;
+
     /**
      * @fn Fit
      * set parameters, returned by maximium-likelihood estimator if unbiased = false,
@@ -173,6 +173,24 @@ void ParetoRand::Fit(const std::vector<double> &sample)
     if (minVar <= 0)
         throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, "All elements in the sample should be positive"));
 
-    SetShape(GetSampleLogMean(sample));
+    SetShape(1.0 / (GetSampleLogMean(sample) - std::log(minVar)));
+    SetScale(minVar);
+}
+
+void ParetoRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    FitFromStatistics(statistics);
+}
+
+void ParetoRand::FitFromStatistics(const SufficientStatistics &statistics)
+{
+    checkStatistics(statistics, SufficientStatistics::LOG_MOMENTS);
+    double minVar = statistics.GetMin();
+    if (minVar <= 0)
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, "All elements in the sample should be positive"));
+
+    SetShape(1.0 / (statistics.GetLogMean() - std::log(minVar)));
     SetScale(minVar);
 }
@@ -68,6 +68,26 @@ public:
      * @param sample
      */
     void Fit(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn CreateStatistics
+     * @return empty accumulator of statistics, sufficient for FitFromStatistics
+     */
+    static SufficientStatistics CreateStatistics() { return SufficientStatistics(SufficientStatistics::MOMENTS | SufficientStatistics::LOG_MOMENTS); }
+
+    /**
+     * @fn FitFromStatistics
+     * set shape and scale in the same way as Fit for the whole sample
+     * @param statistics
+     */
+    void FitFromStatistics(const SufficientStatistics &statistics);
 };
 
 #endif // PARETORAND_H
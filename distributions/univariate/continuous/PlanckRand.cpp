@@ -77,7 +77,7 @@ double PlanckRand::F(const double & x) const
         return 0.0;
 
     if (a >= 1) {
-        return RandMath::integral([this] (double t)
+        return RandMath::integralAdaptiveSimpson([this] (double t)
         {
             return f(t);
         },
@@ -87,7 +87,7 @@ double PlanckRand::F(const double & x) const
     /// split F(x) by two integrals
     double aux = pdfCoef + a * std::log(x);
     double integral1 = std::exp(aux) / (b * a);
-    double integral2 = RandMath::integral([this] (double t)
+    double integral2 = RandMath::integralAdaptiveSimpson([this] (double t)
     {
         return leveledPdf(t);
     },
@@ -193,7 +193,7 @@ std::complex<double> PlanckRand::CFImpl(double t) const
     /// numerically leveled pdf and add known solution for level.
     /// Second one from 1 to infinity, for which we use
     /// simple expected value for the rest of the function
-    double re1 = RandMath::integral([this, t] (double x)
+    double re1 = RandMath::integralAdaptiveSimpson([this, t] (double x)
     {
         return std::cos(t * x) * leveledPdf(x);
     },
@@ -205,7 +205,7 @@ std::complex<double> PlanckRand::CFImpl(double t) const
     },
     1.0, INFINITY);
 
-    double re3 = t * RandMath::integral([this, t] (double x)
+    double re3 = t * RandMath::integralAdaptiveSimpson([this, t] (double x)
     {
         if (x <= 0.0)
             return 0.0;
@@ -1,5 +1,6 @@
 #include "RaisedCosineRand.h"
 #include "UniformRand.h"
+#include "ZigguratSampler.h"
 
 RaisedCosineDistribution::RaisedCosineDistribution(double location, double scale)
 {
@@ -68,33 +69,10 @@ double RaisedCosineDistribution::S(const double & x) const
 
 double RaisedCosineDistribution::StandardVariate(RandGenerator &randGenerator)
 {
-    /// p. 160. Non-Uniform Random Variate Generation. Luc Devroye
-    double X = M_PI * UniformRand::StandardVariate(randGenerator) - M_PI_2;
-    double XSq = X * X;
-    double U = UniformRand::StandardVariate(randGenerator);
-    U += U;
-    int a = 0, b = -1;
-    double W = 0.0, V = 1.0;
-    int iter = 0;
-    do {
-        a += 2;
-        b += 2;
-        V *= XSq / (a * b);
-        W += V;
-        if (U >= W)
-            return X;
-        a += 2;
-        b += 2;
-        V *= XSq / (a * b);
-        W -= V;
-        if (U <= W)
-        {
-            if (X == 0.0)
-                return 0.0;
-            return (X > 0.0) ? M_PI - X : -M_PI - X;
-        }
-    } while (++iter <= MAX_ITER_REJECTION);
-    return NAN;
+    static const ZigguratSampler ziggurat([] (double x) { return (x < M_PI) ? 1.0 + std::cos(x) : 0.0; },
+                                          [] (double y) { return std::acos(y - 1.0); },
+                                          [] (double x) { return (x < M_PI) ? M_PI - x - std::sin(x) : 0.0; }, true);
+    return ziggurat.Variate(randGenerator);
 }
 
 double RaisedCosineDistribution::Variate() const
@@ -5,6 +5,7 @@
 #include "UniformRand.h"
 #include "ExponentialRand.h"
 #include <functional>
+#include <algorithm>
 
 StableDistribution::StableDistribution(double exponent, double skewness, double scale, double location)
 {
@@ -47,6 +48,10 @@ void StableDistribution::SetParameters(double exponent, double skewness, double
     if (exponent == 1.0 && skewness != 0.0 && std::fabs(skewness) < 0.01)
         throw std::invalid_argument("Stable distribution: skewness close to 0 with exponent equal to 1 is not yet supported");
 
+    /// tables are built for standardized distribution, therefore they depend only on α and β
+    if (exponent != alpha || skewness != beta)
+        ClearTables();
+
     alpha = exponent;
     alphaInv = 1.0 / alpha;
     beta = skewness;
@@ -100,6 +105,18 @@ void StableDistribution::SetParameters(double exponent, double skewness, double
             /// corresponds to 6
             seriesZeroParams.second = M_LN2 + M_LN3;
         }
+        /// coefficients of series expansions at infinity for x < 0 and x > 0
+        for (int i = 0; i != 2; ++i) {
+            double rhoPi = alpha * (M_PI_2 + (i ? xi : -xi));
+            for (int n = 1; n <= TAIL_SERIES_SIZE; ++n) {
+                double sinRhoPiN = std::sin(rhoPi * n);
+                double logFact = RandMath::lfact(n);
+                double pdfTerm = M_1_PI * std::exp(std::lgamma(n * alpha + 1.0) - logFact - omega) * sinRhoPiN;
+                double cdfTerm = M_1_PI * std::exp(std::lgamma(n * alpha) - logFact) * sinRhoPiN;
+                pdfTailCoefs[i][n - 1] = (n & 1) ? pdfTerm : -pdfTerm;
+                cdfTailCoefs[i][n - 1] = (n & 1) ? cdfTerm : -cdfTerm;
+            }
+        }
     }
 }
 
@@ -237,8 +254,8 @@ double StableDistribution::pdfForUnityExponent(double x) const
 
     /// Find peak of the integrand
     double theta0 = 0;
-    std::function<double (double)> funPtr = std::bind(&StableDistribution::integrandAuxForUnityExponent, this, std::placeholders::_1, xAdj);
-    RandMath::findRoot(funPtr, lowerBoundary, upperBoundary, theta0);
+    auto funPtr = [this, xAdj] (double theta) { return integrandAuxForUnityExponent(theta, xAdj); };
+    RandMath::findRootBrent(funPtr, lowerBoundary, upperBoundary, theta0);
 
     /// Sanity check
     /// if we failed while looking for the peak position
@@ -246,7 +263,7 @@ double StableDistribution::pdfForUnityExponent(double x) const
     if (theta0 >= upperBoundary || theta0 <= lowerBoundary)
         theta0 = 0.5 * (upperBoundary + lowerBoundary);
 
-    std::function<double (double)> integrandPtr = std::bind(&StableDistribution::integrandForUnityExponent, this, std::placeholders::_1, xAdj);
+    auto integrandPtr = [this, xAdj] (double theta) { return integrandForUnityExponent(theta, xAdj); };
 
     /// If theta0 is too close to +/-π/2 then we can still underestimate the integral
     int maxRecursionDepth = 11;
@@ -256,8 +273,8 @@ double StableDistribution::pdfForUnityExponent(double x) const
     else if (closeness < 0.2)
         maxRecursionDepth = 15;
 
-    double int1 = RandMath::integral(integrandPtr, lowerBoundary, theta0, 1e-11, maxRecursionDepth);
-    double int2 = RandMath::integral(integrandPtr, theta0, upperBoundary, 1e-11, maxRecursionDepth);
+    double int1 = RandMath::integralAdaptiveSimpson(integrandPtr, lowerBoundary, theta0, 1e-11, maxRecursionDepth);
+    double int2 = RandMath::integralAdaptiveSimpson(integrandPtr, theta0, upperBoundary, 1e-11, maxRecursionDepth);
     return pdfCoef * (int1 + int2);
 }
 
@@ -319,22 +336,14 @@ double StableDistribution::pdfSeriesExpansionAtZero(double logX, double xiAdj, i
     return y0 + sum * M_1_PI / alpha;
 }
 
-double StableDistribution::pdfSeriesExpansionAtInf(double logX, double xiAdj) const
+double StableDistribution::pdfSeriesExpansionAtInf(double logX, bool isRightTail) const
 {
-    static constexpr int k = 10; ///< number of elements in the series
-    double rhoPi = M_PI_2 + xiAdj;
-    rhoPi *= alpha;
+    const auto &coefs = pdfTailCoefs[isRightTail];
+    double w = std::exp(-alpha * logX);
     double sum = 0.0;
-    for (int n = 1; n <= k; ++n) {
-        double aux = n * alpha + 1.0;
-        double term = std::lgamma(aux);
-        term -= aux * logX;
-        term -= RandMath::lfact(n);
-        term = std::exp(term - omega);
-        term *= std::sin(rhoPi * n);
-        sum += (n & 1) ? term : -term;
-    }
-    return M_1_PI * sum;
+    for (int n = TAIL_SERIES_SIZE - 1; n >= 0; --n)
+        sum = w * (coefs[n] + sum);
+    return sum * std::exp(-logX);
 }
 
 double StableDistribution::pdfTaylorExpansionTailNearCauchy(double x) const
@@ -478,23 +487,23 @@ double StableDistribution::pdfForGeneralExponent(double x) const
     /// If x is too close to 0, we do series expansion avoiding numerical problems
     if (logAbsX < seriesZeroParams.second) {
         if (alpha < 1 && std::fabs(beta) == 1)
-            return pdfShortTailExpansionForGeneralExponent(logAbsX);
+            return pdfShortTailExpansionForGeneralExponent(logAbsX) / gamma;
         return pdfSeriesExpansionAtZero(logAbsX, xiAdj, seriesZeroParams.first) / gamma;
     }
 
     /// If x is large enough we use tail approximation
     if (logAbsX > pdftailBound && alpha <= ALMOST_TWO) {
         if (alpha > 1 && std::fabs(beta) == 1)
-            return pdfShortTailExpansionForGeneralExponent(logAbsX);
-        return pdfSeriesExpansionAtInf(logAbsX, xiAdj) / gamma;
+            return pdfShortTailExpansionForGeneralExponent(logAbsX) / gamma;
+        return pdfSeriesExpansionAtInf(logAbsX, xSt > 0) / gamma;
     }
 
     double xAdj = alpha_alpham1 * logAbsX;
 
     /// Search for the peak of the integrand
-    double theta0;
-    std::function<double (double)> funPtr = std::bind(&StableDistribution::integrandAuxForGeneralExponent, this, std::placeholders::_1, xAdj, xiAdj);
-    RandMath::findRoot(funPtr, -xiAdj, M_PI_2, theta0);
+    double theta0 = 0.5 * (M_PI_2 - xiAdj);
+    auto funPtr = [this, xAdj, xiAdj] (double theta) { return integrandAuxForGeneralExponent(theta, xAdj, xiAdj); };
+    RandMath::findRootBrent(funPtr, -xiAdj, M_PI_2, theta0);
 
     /// If theta0 is too close to π/2 or -xiAdj then we can still underestimate the integral
     int maxRecursionDepth = 11;
@@ -505,9 +514,9 @@ double StableDistribution::pdfForGeneralExponent(double x) const
         maxRecursionDepth = 15;
 
     /// Calculate sum of two integrals
-    std::function<double (double)> integrandPtr = std::bind(&StableDistribution::integrandFoGeneralExponent, this, std::placeholders::_1, xAdj, xiAdj);
-    double int1 = RandMath::integral(integrandPtr, -xiAdj, theta0, 1e-11, maxRecursionDepth);
-    double int2 = RandMath::integral(integrandPtr, theta0, M_PI_2, 1e-11, maxRecursionDepth);
+    auto integrandPtr = [this, xAdj, xiAdj] (double theta) { return integrandFoGeneralExponent(theta, xAdj, xiAdj); };
+    double int1 = RandMath::integralAdaptiveSimpson(integrandPtr, -xiAdj, theta0, 1e-11, maxRecursionDepth);
+    double int2 = RandMath::integralAdaptiveSimpson(integrandPtr, theta0, M_PI_2, 1e-11, maxRecursionDepth);
     double res = pdfCoef * (int1 + int2) / absXSt;
 
     /// Finally we check if α is not too close to 2
@@ -524,6 +533,155 @@ double StableDistribution::pdfForGeneralExponent(double x) const
     return std::max(tail, res);
 }
 
+void StableDistribution::Tabulate(double tolerance)
+{
+    tabulate(tolerance, true);
+}
+
+void StableDistribution::tabulate(double tolerance, bool isCdfTabulated)
+{
+    if (tolerance <= 0.0)
+        throw std::invalid_argument("Stable distribution: tolerance of tables should be positive");
+    ClearTables();
+    if (distributionType != GENERAL)
+        return;
+
+    /// Find boundaries of the region, where integral representations and series at zero are in use
+    double zeroBound = std::log1p(std::exp(seriesZeroParams.second + omega));
+    double pdfBound = std::log1p(std::exp(pdftailBound + omega));
+    double cdfBound = std::log1p(std::exp(cdftailBound + omega));
+    /// Tables are built for γ = 1 and μ = 0 by standardized copy, so that this distribution is never changed
+    StableRand standardized(alpha, beta);
+    const StableDistribution &st = standardized;
+    std::vector<double> pdfBreakpoints, cdfBreakpoints;
+    if (alpha < 1 && beta == 1) {
+        pdfBreakpoints = {zeroBound, pdfBound};
+        cdfBreakpoints = {zeroBound, cdfBound};
+    }
+    else if (alpha < 1 && beta == -1) {
+        pdfBreakpoints = {-pdfBound, -zeroBound};
+        cdfBreakpoints = {-cdfBound, -zeroBound};
+    }
+    else {
+        pdfBreakpoints = {-pdfBound, -zeroBound, 0.0, zeroBound, pdfBound};
+        cdfBreakpoints = {-cdfBound, -zeroBound, 0.0, zeroBound, cdfBound};
+    }
+    ChebyshevTable pdfTableSt, cdfTableSt;
+    buildTable(pdfTableSt, [&st] (double t) {
+        double xSt = (t < 0) ? -std::expm1(-t) : std::expm1(t);
+        return std::log(st.pdfForGeneralExponent(xSt));
+    }, pdfBreakpoints, tolerance);
+    if (isCdfTabulated) {
+        double median = st.Median();
+        double tMedian = (median < 0) ? -std::log1p(-median) : std::log1p(median);
+        cdfBreakpoints.push_back(tMedian);
+        std::sort(cdfBreakpoints.begin(), cdfBreakpoints.end());
+        buildTable(cdfTableSt, [&st, tMedian] (double t) {
+            double xSt = (t < 0) ? -std::expm1(-t) : std::expm1(t);
+            double y = st.cdfForGeneralExponent(xSt);
+            return (t < tMedian) ? std::log(y) : std::log1p(-y);
+        }, cdfBreakpoints, tolerance);
+        cdfTableMedian = median;
+    }
+    pdfTable = std::move(pdfTableSt);
+    cdfTable = std::move(cdfTableSt);
+}
+
+void StableDistribution::ClearTables()
+{
+    pdfTable.bounds.clear();
+    pdfTable.coefs.clear();
+    cdfTable.bounds.clear();
+    cdfTable.coefs.clear();
+}
+
+void StableDistribution::buildTable(ChebyshevTable &table, const std::function<double (double)> &fun,
+                                    const std::vector<double> &breakpoints, double tolerance)
+{
+    static constexpr int INITIAL_PIECES = 4;
+    table.bounds.push_back(breakpoints.front());
+    for (size_t i = 1; i < breakpoints.size(); ++i) {
+        double a = breakpoints[i - 1], b = breakpoints[i];
+        if (b <= a)
+            continue;
+        double step = (b - a) / INITIAL_PIECES;
+        for (int j = 0; j < INITIAL_PIECES; ++j) {
+            double right = (j == INITIAL_PIECES - 1) ? b : a + (j + 1) * step;
+            addTablePiece(table, fun, a + j * step, right, tolerance, 0, INFINITY);
+        }
+    }
+}
+
+void StableDistribution::addTablePiece(ChebyshevTable &table, const std::function<double (double)> &fun,
+                                       double a, double b, double tolerance, int depth, double parentError)
+{
+    static constexpr int n = TABLE_DEGREE;
+    double center = 0.5 * (a + b), halfWidth = 0.5 * (b - a);
+    /// Values in Chebyshev-Lobatto nodes cos(πj/n)
+    double values[n + 1];
+    bool isFinite = true;
+    for (int j = 0; j <= n; ++j) {
+        values[j] = fun(center + halfWidth * std::cos(M_PI * j / n));
+        isFinite = isFinite && std::isfinite(values[j]);
+    }
+    double coefs[n + 1];
+    for (int k = 0; k <= n; ++k) {
+        double sum = 0.5 * (values[0] + ((k & 1) ? -values[n] : values[n]));
+        for (int j = 1; j < n; ++j)
+            sum += values[j] * std::cos(M_PI * j * k / n);
+        coefs[k] = 2.0 * sum / n;
+    }
+    coefs[0] *= 0.5;
+    coefs[n] *= 0.5;
+
+    /// Check the error between the nodes
+    double error = isFinite ? 0.0 : INFINITY;
+    for (int j = 0; isFinite && j < n; ++j) {
+        double u = std::cos(M_PI * (j + 0.5) / n);
+        double y = fun(center + halfWidth * u);
+        double b1 = 0, b2 = 0;
+        for (int k = n; k > 0; --k) {
+            double b0 = coefs[k] + 2 * u * b1 - b2;
+            b2 = b1;
+            b1 = b0;
+        }
+        double absError = std::fabs(coefs[0] + u * b1 - b2 - y);
+        error = std::isnan(absError) ? INFINITY : std::max(error, absError);
+    }
+
+    /// Split the piece while it improves the accuracy: if the error doesn't decrease,
+    /// then it is dominated by the error of exact evaluation and the piece is left for it
+    bool isAccurate = (error <= tolerance);
+    if (!isAccurate && depth < MAX_TABLE_DEPTH && (depth < MIN_TABLE_DEPTH || error < 0.5 * parentError)) {
+        addTablePiece(table, fun, a, center, tolerance, depth + 1, error);
+        addTablePiece(table, fun, center, b, tolerance, depth + 1, error);
+        return;
+    }
+    table.bounds.push_back(b);
+    for (int k = 0; k <= n; ++k)
+        table.coefs.push_back(isAccurate ? coefs[k] : NAN);
+}
+
+double StableDistribution::evaluateTable(const ChebyshevTable &table, double xSt)
+{
+    double t = (xSt < 0) ? -std::log1p(-xSt) : std::log1p(xSt);
+    if (!(t >= table.bounds.front() && t <= table.bounds.back()))
+        return NAN;
+    auto it = std::upper_bound(table.bounds.begin() + 1, table.bounds.end() - 1, t);
+    int i = it - table.bounds.begin() - 1;
+    double a = table.bounds[i], b = table.bounds[i + 1];
+    double u = (2 * t - a - b) / (b - a);
+    const double *c = table.coefs.data() + i * (TABLE_DEGREE + 1);
+    /// Clenshaw recurrence
+    double b1 = 0, b2 = 0;
+    for (int k = TABLE_DEGREE; k > 0; --k) {
+        double b0 = c[k] + 2 * u * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return c[0] + u * b1 - b2;
+}
+
 double StableDistribution::f(const double & x) const
 {
     switch (distributionType) {
@@ -536,6 +694,11 @@ double StableDistribution::f(const double & x) const
     case UNITY_EXPONENT:
         return pdfForUnityExponent(x);
     case GENERAL:
+        if (IsTabulated()) {
+            double y = evaluateTable(pdfTable, (x - mu) / gamma);
+            if (!std::isnan(y))
+                return std::exp(y) / gamma;
+        }
         return pdfForGeneralExponent(x);
     default:
         return NAN; /// unexpected return
@@ -554,6 +717,11 @@ double StableDistribution::logf(const double & x) const
     case UNITY_EXPONENT:
         return std::log(pdfForUnityExponent(x));
     case GENERAL:
+        if (IsTabulated()) {
+            double y = evaluateTable(pdfTable, (x - mu) / gamma);
+            if (!std::isnan(y))
+                return y - logGamma;
+        }
         return std::log(pdfForGeneralExponent(x));
     default:
         return NAN; /// unexpected return
@@ -629,7 +797,7 @@ double StableDistribution::cdfForUnityExponent(double x) const
 {
     double xSt = (x - mu) / gamma;
     double xAdj = -M_PI_2 * xSt / beta - logGammaPi_2;
-    double y = M_1_PI * RandMath::integral([this, xAdj] (double theta)
+    double y = M_1_PI * RandMath::integralAdaptiveSimpson([this, xAdj] (double theta)
     {
         double u = integrandAuxForUnityExponent(theta, xAdj);
         return fastcdfExponentiation(u);
@@ -670,28 +838,20 @@ double StableDistribution::cdfSeriesExpansionAtZero(double logX, double xiAdj, i
     return y0 + sum * M_1_PI * alphaInv;
 }
 
-double StableDistribution::cdfSeriesExpansionAtInf(double logX, double xiAdj) const
+double StableDistribution::cdfSeriesExpansionAtInf(double logX, bool isRightTail) const
 {
-    static constexpr int k = 10; /// number of elements in the series
-    double rhoPi = M_PI_2 + xiAdj;
-    rhoPi *= alpha;
+    const auto &coefs = cdfTailCoefs[isRightTail];
+    double w = std::exp(-alpha * logX);
     double sum = 0.0;
-    for (int n = 1; n <= k; ++n) {
-        double aux = n * alpha;
-        double term = std::lgamma(aux);
-        term -= aux * logX;
-        term -= RandMath::lfact(n);
-        term = std::exp(term);
-        term *= std::sin(rhoPi * n);
-        sum += (n & 1) ? term : -term;
-    }
-    return M_1_PI * sum;
+    for (int n = TAIL_SERIES_SIZE - 1; n >= 0; --n)
+        sum = w * (coefs[n] + sum);
+    return sum;
 }
 
 double StableDistribution::cdfIntegralRepresentation(double logX, double xiAdj) const
 {
     double xAdj = alpha_alpham1 * logX;
-    return M_1_PI * RandMath::integral([this, xAdj, xiAdj] (double theta)
+    return M_1_PI * RandMath::integralAdaptiveSimpson([this, xAdj, xiAdj] (double theta)
     {
         double u = integrandAuxForGeneralExponent(theta, xAdj, xiAdj);
         return fastcdfExponentiation(u);
@@ -711,7 +871,7 @@ double StableDistribution::cdfForGeneralExponent(double x) const
             return cdfSeriesExpansionAtZero(logAbsX, xi, seriesZeroParams.first);
         /// If x is large enough we use tail approximation
         if (logAbsX > cdftailBound)
-            return 1.0 - cdfSeriesExpansionAtInf(logAbsX, xi);
+            return 1.0 - cdfSeriesExpansionAtInf(logAbsX, true);
         if (alpha > 1.0)
             return 1.0 - cdfIntegralRepresentation(logAbsX, xi);
         return (beta == -1.0) ? 1.0 : cdfAtZero(xi) + cdfIntegralRepresentation(logAbsX, xi);
@@ -721,7 +881,7 @@ double StableDistribution::cdfForGeneralExponent(double x) const
     if (logAbsX < seriesZeroParams.second)
         return 1.0 - cdfSeriesExpansionAtZero(logAbsX, -xi, seriesZeroParams.first);
     if (logAbsX > cdftailBound)
-        return cdfSeriesExpansionAtInf(logAbsX, -xi);
+        return cdfSeriesExpansionAtInf(logAbsX, false);
     if (alpha > 1.0)
         return cdfIntegralRepresentation(logAbsX, -xi);
     return (beta == 1.0) ? 0.0 : cdfAtZero(xi) - cdfIntegralRepresentation(logAbsX, -xi);
@@ -739,6 +899,12 @@ double StableDistribution::F(const double & x) const
     case UNITY_EXPONENT:
         return cdfForUnityExponent(x);
     case GENERAL:
+        if (!cdfTable.bounds.empty()) {
+            double xSt = (x - mu) / gamma;
+            double y = evaluateTable(cdfTable, xSt);
+            if (!std::isnan(y))
+                return (xSt < cdfTableMedian) ? std::exp(y) : -std::expm1(y);
+        }
         return cdfForGeneralExponent(x);
     default:
         return NAN; /// unexpected return
@@ -757,6 +923,12 @@ double StableDistribution::S(const double & x) const
     case UNITY_EXPONENT:
         return 1.0 - cdfForUnityExponent(x);
     case GENERAL:
+        if (!cdfTable.bounds.empty()) {
+            double xSt = (x - mu) / gamma;
+            double y = evaluateTable(cdfTable, xSt);
+            if (!std::isnan(y))
+                return (xSt < cdfTableMedian) ? -std::expm1(y) : std::exp(y);
+        }
         return 1.0 - cdfForGeneralExponent(x);
     default:
         return NAN; /// unexpected return
@@ -1004,7 +1176,7 @@ std::complex<double> StableDistribution::CFImpl(double t) const
         x = beta * M_2_PI * std::log(t);
         break;
     default:
-        x = -zeta;
+        x = zeta;
     }
     double re = std::pow(gamma * t, alpha);
     std::complex<double> psi = std::complex<double>(re, re * x - mu * t);
@@ -1020,6 +1192,278 @@ String StableRand::Name() const
             + toStringWithPrecision(GetLocation()) + ")";
 }
 
+void StableRand::FitByQuantiles(const std::vector<double> &sample)
+{
+    if (sample.size() < 5)
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should contain at least 5 elements"));
+    /// Tables III-V and VII of McCulloch (1986)
+    static constexpr double NU_ALPHA[15] = {2.439, 2.5, 2.6, 2.7, 2.8, 3.0, 3.2, 3.5, 4.0, 5.0, 6.0, 8.0, 10.0, 15.0, 25.0};
+    static constexpr double NU_BETA[7] = {0.0, 0.1, 0.2, 0.3, 0.5, 0.7, 1.0};
+    /// α = ψ1(ν_α, ν_β)
+    static constexpr double PSI_ALPHA[15 * 7] = {
+        2.000, 2.000, 2.000, 2.000, 2.000, 2.000, 2.000,
+        1.916, 1.924, 1.924, 1.924, 1.924, 1.924, 1.924,
+        1.808, 1.813, 1.829, 1.829, 1.829, 1.829, 1.829,
+        1.729, 1.730, 1.737, 1.745, 1.745, 1.745, 1.745,
+        1.664, 1.663, 1.663, 1.668, 1.676, 1.676, 1.676,
+        1.563, 1.560, 1.553, 1.548, 1.547, 1.547, 1.547,
+        1.484, 1.480, 1.471, 1.460, 1.448, 1.438, 1.438,
+        1.391, 1.386, 1.378, 1.364, 1.337, 1.318, 1.318,
+        1.279, 1.273, 1.266, 1.250, 1.210, 1.184, 1.150,
+        1.128, 1.121, 1.114, 1.101, 1.067, 1.027, 0.973,
+        1.029, 1.021, 1.014, 1.004, 0.974, 0.935, 0.874,
+        0.896, 0.892, 0.884, 0.883, 0.855, 0.823, 0.769,
+        0.818, 0.812, 0.806, 0.801, 0.780, 0.756, 0.691,
+        0.698, 0.695, 0.692, 0.689, 0.676, 0.656, 0.597,
+        0.593, 0.590, 0.588, 0.586, 0.579, 0.563, 0.513
+    };
+    /// β = ψ2(ν_α, ν_β)
+    static constexpr double PSI_BETA[15 * 7] = {
+        0.000, 2.160, 1.000, 1.000, 1.000, 1.000, 1.000,
+        0.000, 1.592, 3.390, 1.000, 1.000, 1.000, 1.000,
+        0.000, 0.759, 1.800, 1.000, 1.000, 1.000, 1.000,
+        0.000, 0.482, 1.048, 1.694, 1.000, 1.000, 1.000,
+        0.000, 0.360, 0.760, 1.232, 2.229, 1.000, 1.000,
+        0.000, 0.253, 0.518, 0.823, 1.575, 1.000, 1.000,
+        0.000, 0.203, 0.410, 0.632, 1.244, 1.906, 1.000,
+        0.000, 0.165, 0.332, 0.499, 0.943, 1.560, 1.000,
+        0.000, 0.136, 0.271, 0.404, 0.689, 1.230, 2.195,
+        0.000, 0.109, 0.216, 0.323, 0.539, 0.827, 1.917,
+        0.000, 0.096, 0.190, 0.284, 0.472, 0.693, 1.759,
+        0.000, 0.082, 0.163, 0.243, 0.412, 0.601, 1.596,
+        0.000, 0.074, 0.147, 0.220, 0.377, 0.546, 1.482,
+        0.000, 0.064, 0.128, 0.191, 0.330, 0.478, 1.362,
+        0.000, 0.056, 0.112, 0.167, 0.285, 0.428, 1.274
+    };
+    static constexpr double ALPHA[16] = {0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, 2.0};
+    static constexpr double BETA[5] = {0.0, 0.25, 0.5, 0.75, 1.0};
+    /// ν_γ = φ3(α, β)
+    static constexpr double PHI_SCALE[16 * 5] = {
+        2.588, 3.073, 4.534, 6.636, 9.144,
+        2.337, 2.634, 3.542, 4.808, 6.247,
+        2.189, 2.392, 3.004, 3.844, 4.775,
+        2.098, 2.244, 2.676, 3.265, 3.912,
+        2.040, 2.149, 2.461, 2.886, 3.356,
+        2.000, 2.085, 2.311, 2.624, 2.973,
+        1.980, 2.040, 2.205, 2.435, 2.696,
+        1.965, 2.007, 2.125, 2.294, 2.491,
+        1.955, 1.984, 2.067, 2.188, 2.333,
+        1.946, 1.967, 2.022, 2.106, 2.211,
+        1.939, 1.952, 1.988, 2.045, 2.116,
+        1.933, 1.940, 1.962, 1.997, 2.043,
+        1.927, 1.930, 1.943, 1.961, 1.987,
+        1.921, 1.922, 1.927, 1.936, 1.947,
+        1.914, 1.915, 1.916, 1.918, 1.921,
+        1.908, 1.908, 1.908, 1.908, 1.908
+    };
+    /// ν_ζ = φ5(α, β)
+    static constexpr double PHI_LOCATION[16 * 5] = {
+        0.000, -0.061, -0.279, -0.659, -1.198,
+        0.000, -0.078, -0.272, -0.581, -0.997,
+        0.000, -0.089, -0.262, -0.520, -0.853,
+        0.000, -0.096, -0.250, -0.469, -0.742,
+        0.000, -0.099, -0.237, -0.424, -0.652,
+        0.000, -0.098, -0.223, -0.380, -0.576,
+        0.000, -0.095, -0.208, -0.346, -0.508,
+        0.000, -0.090, -0.192, -0.310, -0.447,
+        0.000, -0.084, -0.173, -0.276, -0.390,
+        0.000, -0.075, -0.154, -0.241, -0.335,
+        0.000, -0.066, -0.134, -0.206, -0.283,
+        0.000, -0.056, -0.111, -0.170, -0.232,
+        0.000, -0.043, -0.088, -0.132, -0.179,
+        0.000, -0.030, -0.061, -0.092, -0.123,
+        0.000, -0.017, -0.032, -0.049, -0.064,
+        0.000, 0.000, 0.000, 0.000, 0.000
+    };
+
+    std::vector<double> quantiles = GetSampleQuantiles(sample, {0.05, 0.25, 0.5, 0.75, 0.95});
+    double q05 = quantiles[0], q25 = quantiles[1], q50 = quantiles[2], q75 = quantiles[3], q95 = quantiles[4];
+    double iqr = q75 - q25;
+    if (iqr <= 0.0 || q95 <= q05)
+        throw std::runtime_error(fitErrorDescription(WRONG_RETURN, "Interquartile range should be positive"));
+    double nuAlpha = (q95 - q05) / iqr;
+    double nuBeta = (q95 + q05 - 2 * q50) / (q95 - q05);
+
+    double exponent = 2.0, skewness = 0.0;
+    if (nuAlpha >= NU_ALPHA[0]) {
+        exponent = interpolateTable(NU_ALPHA, 15, NU_BETA, 7, PSI_ALPHA, nuAlpha, std::fabs(nuBeta));
+        exponent = std::min(std::max(exponent, 0.5), 2.0);
+        skewness = interpolateTable(NU_ALPHA, 15, NU_BETA, 7, PSI_BETA, nuAlpha, std::fabs(nuBeta));
+        skewness = std::copysign(std::min(skewness, 1.0), nuBeta);
+    }
+    /// ζ -> δ conversion below is singular at α = 1, hence α is snapped before it
+    exponent = snapEstimatedExponent(exponent, sample.size());
+    if (exponent == 1.0 && std::fabs(skewness) < 0.01)
+        skewness = 0.0;
+    double absSkewness = std::fabs(skewness);
+    double scale = iqr / interpolateTable(ALPHA, 16, BETA, 5, PHI_SCALE, exponent, absSkewness);
+    /// φ5(α, -β) = -φ5(α, β), table is given for β ≥ 0
+    double shift = scale * interpolateTable(ALPHA, 16, BETA, 5, PHI_LOCATION, exponent, absSkewness);
+    double shiftedLocation = q50 + (skewness < 0 ? -shift : shift);
+    /// McCulloch's location ζ is the one of parameterization, continuous in α
+    double location = shiftedLocation - locationShift(exponent, skewness, scale);
+    setEstimatedParameters(exponent, skewness, scale, location);
+}
+
+void StableRand::FitByCharacteristicFunction(const std::vector<double> &sample)
+{
+    static constexpr int SIZE = 10;
+    static constexpr double STEP = 0.1;
+    FitByQuantiles(sample);
+    double scale0 = gamma, location0 = mu;
+
+    /// Empirical characteristic function of standardized sample (x - μ0) / γ0 in points t_k = 0.1k
+    std::vector<std::complex<double>> cf = GetSampleCharacteristicFunction(sample, STEP / scale0, SIZE);
+    std::vector<double> logT(SIZE), y, x;
+    for (int k = 0; k != SIZE; ++k) {
+        double t = STEP * (k + 1);
+        logT[k] = std::log(t);
+        cf[k] *= std::exp(std::complex<double>(0.0, -t * location0 / scale0));
+        /// log(-log|φ(t)|^2) = log(2) + α log(γ) + α log(t)
+        double absCfSq = std::norm(cf[k]);
+        if (absCfSq > 0.0 && absCfSq < 1.0) {
+            x.push_back(logT[k]);
+            y.push_back(std::log(-std::log(absCfSq)));
+        }
+    }
+    if (x.size() < 2)
+        return;
+    double n = x.size(), sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    for (size_t i = 0; i != x.size(); ++i) {
+        sumX += x[i];
+        sumY += y[i];
+        sumXX += x[i] * x[i];
+        sumXY += x[i] * y[i];
+    }
+    double slope = (n * sumXY - sumX * sumY) / (n * sumXX - sumX * sumX);
+    double intercept = (sumY - slope * sumX) / n;
+    double exponent = std::min(std::max(slope, 0.1), 2.0);
+    double scale = std::exp((intercept - M_LN2) / exponent);
+    exponent = snapEstimatedExponent(exponent, sample.size());
+
+    /// Arg φ(t) = δt + βγ^α tan(πα / 2) t^α for α ≠ 1 and δt - 2 / π βγ t log(t) for α = 1,
+    /// δ and β are found by least squares without intercept
+    double a11 = 0, a12 = 0, a22 = 0, b1 = 0, b2 = 0;
+    double skewnessCoef = (exponent == 1.0) ? -M_2_PI * scale : std::pow(scale, exponent) * std::tan(M_PI_2 * exponent);
+    double z = 0.0;
+    for (int k = 0; k != SIZE; ++k) {
+        double t = STEP * (k + 1);
+        double u = skewnessCoef * ((exponent == 1.0) ? t * logT[k] : std::exp(exponent * logT[k]));
+        /// phase is unwrapped, as it can leave (-π, π] for heavy-tailed skewed laws
+        double increment = std::arg(cf[k]) - z;
+        z += increment - 2 * M_PI * std::round(increment / (2 * M_PI));
+        a11 += t * t;
+        a12 += t * u;
+        a22 += u * u;
+        b1 += t * z;
+        b2 += u * z;
+    }
+    /// for α close to 2 skewness doesn't affect the characteristic function
+    double det = a11 * a22 - a12 * a12;
+    double location = b1 / a11, skewness = 0.0;
+    if (std::fabs(skewnessCoef) > 0.01 && det > 0.0) {
+        location = (a22 * b1 - a12 * b2) / det;
+        skewness = std::min(std::max((a11 * b2 - a12 * b1) / det, -1.0), 1.0);
+    }
+
+    /// Return to the original scale: for α = 1 location gets the additional term
+    location = location0 + scale0 * location;
+    if (exponent == 1.0)
+        location += M_2_PI * skewness * scale * scale0 * std::log(scale0);
+    setEstimatedParameters(exponent, skewness, scale * scale0, location);
+}
+
+void StableRand::setEstimatedParameters(double exponent, double skewness, double scale, double location)
+{
+    if (exponent != 1.0 && std::fabs(exponent - 1.0) < 0.01 && skewness != 0.0)
+        exponent = 1.0;
+    if (exponent == 1.0 && std::fabs(skewness) < 0.01)
+        skewness = 0.0;
+    SetParameters(exponent, skewness, scale, location);
+}
+
+double StableRand::locationShift(double exponent, double skewness, double scale)
+{
+    if (exponent == 1.0)
+        return -M_2_PI * skewness * scale * std::log(scale);
+    return skewness * scale * std::tan(M_PI_2 * exponent);
+}
+
+double StableRand::snapEstimatedExponent(double exponent, size_t sampleSize)
+{
+    /// standard error of estimators of α is about 1 / √n, while location in the used
+    /// parameterization is amplified by tan(πα / 2) near α = 1
+    double tolerance = std::min(std::max(0.01, 2.0 / std::sqrt(sampleSize)), 0.1);
+    return (std::fabs(exponent - 1.0) < tolerance) ? 1.0 : exponent;
+}
+
+double StableRand::interpolateTable(const double *xGrid, size_t xSize, const double *yGrid, size_t ySize, const double *table, double x, double y)
+{
+    x = std::min(std::max(x, xGrid[0]), xGrid[xSize - 1]);
+    y = std::min(std::max(y, yGrid[0]), yGrid[ySize - 1]);
+    size_t i = std::min<size_t>(std::upper_bound(xGrid, xGrid + xSize, x) - xGrid, xSize - 1) - 1;
+    size_t j = std::min<size_t>(std::upper_bound(yGrid, yGrid + ySize, y) - yGrid, ySize - 1) - 1;
+    double u = (x - xGrid[i]) / (xGrid[i + 1] - xGrid[i]);
+    double v = (y - yGrid[j]) / (yGrid[j + 1] - yGrid[j]);
+    const double *row = table + i * ySize, *nextRow = row + ySize;
+    return (1 - u) * ((1 - v) * row[j] + v * row[j + 1]) + u * ((1 - v) * nextRow[j] + v * nextRow[j + 1]);
+}
+
+void StableRand::Fit(const std::vector<double> &sample)
+{
+    FitByCharacteristicFunction(sample);
+
+    /// Tables are dropped on exit, also if an exception is thrown
+    class TablesGuard {
+        StableDistribution &distribution;
+    public:
+        explicit TablesGuard(StableDistribution &stable) : distribution(stable) {}
+        ~TablesGuard() { distribution.ClearTables(); }
+        TablesGuard(const TablesGuard &) = delete;
+        TablesGuard &operator=(const TablesGuard &) = delete;
+    } guard(*this);
+
+    /// Log-likelihood is profiled over (α, β): density is tabulated once for each pair
+    /// and (γ, μ) are fitted with fixed tables, starting from the best values found so far.
+    /// Those are kept with location ζ, as μ jumps around α = 1 for β ≠ 0
+    std::vector<double> scaleLocation = {gamma, mu + locationShift(alpha, beta, gamma)};
+    double bestProfile = INFINITY;
+    MaximumLikelihoodFitter<double> scaleLocationFitter(*this, [this] (const std::vector<double> &theta)
+    {
+        SetScale(theta[0]);
+        SetLocation(theta[1]);
+    },
+    {0.0, -INFINITY}, {INFINITY, INFINITY});
+    auto profile = [this, &sample, &scaleLocation, &bestProfile, &scaleLocationFitter] (const std::vector<double> &shape) -> double
+    {
+        try {
+            SetParameters(shape[0], shape[1], scaleLocation[0], scaleLocation[1] - locationShift(shape[0], shape[1], scaleLocation[0]));
+        }
+        catch (const std::exception &) {
+            return INFINITY;
+        }
+        /// cdf isn't required for likelihood
+        tabulate(PROFILE_TOLERANCE, false);
+        std::vector<double> theta = {gamma, mu};
+        scaleLocationFitter.Fit(sample, theta);
+        double value = -LogLikelihoodFunction(sample) / sample.size();
+        if (value < bestProfile) {
+            bestProfile = value;
+            scaleLocation = {theta[0], theta[1] + locationShift(shape[0], shape[1], theta[0])};
+        }
+        return value;
+    };
+    /// density isn't tabulated for α = 1 and β ≠ 0, hence search starts from the closest supported exponent
+    std::vector<double> shape = {(alpha == 1.0 && beta != 0.0) ? 1.01 : alpha, beta};
+    bool converged = RandMath::findMinNelderMead(profile, shape, {0.1, -1.0}, {2.0, 1.0}, 1e-9, 1e-4);
+    profile(shape);
+    if (!converged)
+        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in optimization procedure"));
+    double exponent = snapEstimatedExponent(alpha, sample.size());
+    if (exponent != alpha)
+        setEstimatedParameters(exponent, beta, gamma, mu + locationShift(alpha, beta, gamma) - locationShift(exponent, beta, gamma));
+}
+
 String HoltsmarkRand::Name() const
 {
     return "Holtsmark("
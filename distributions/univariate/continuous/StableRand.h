@@ -2,6 +2,8 @@
 #define STABLERAND_H
 
 #include "ContinuousDistribution.h"
+#include "../MaximumLikelihoodFitter.h"
+#include <array>
 
 /**
  * @brief The StableDistribution class <BR>
@@ -44,6 +46,27 @@ private:
 
     DISTRIBUTION_TYPE distributionType = NORMAL; ///< type of distribution (Gaussian by default)
 
+    /// degree of Chebyshev polynomials in tables
+    static constexpr int TABLE_DEGREE = 16;
+    /// number of bisections of initial pieces of tables, performed regardless of the decrease of error
+    static constexpr int MIN_TABLE_DEPTH = 6;
+    /// maximal number of bisections of initial pieces of tables
+    static constexpr int MAX_TABLE_DEPTH = 16;
+
+    /**
+     * @brief The ChebyshevTable struct
+     * piecewise Chebyshev interpolant of a function of t = sign(x) log(1 + |x|),
+     * where x is standardized argument
+     */
+    struct ChebyshevTable {
+        std::vector<double> bounds{}; ///< boundaries of pieces in t
+        std::vector<double> coefs{}; ///< Chebyshev coefficients of pieces, NAN for pieces evaluated exactly
+    };
+
+    ChebyshevTable pdfTable{}; ///< log-pdf of standardized distribution
+    ChebyshevTable cdfTable{}; ///< log-cdf below the median and log-survival function above it
+    double cdfTableMedian = 0; ///< standardized median, separating two parts of cdfTable
+
 protected:
     double pdfCoef = 0.5 * (M_LN2 + M_LNPI); ///< hashed coefficient for faster pdf calculations
     double pdftailBound = INFINITY; ///< boundary k such that for |x| > k we can use pdf tail approximation
@@ -90,7 +113,36 @@ public:
      */
     inline double GetLogScale() const { return logGamma; }
 
+    /**
+     * @fn Tabulate
+     * Build piecewise Chebyshev interpolants of log-pdf and log-cdf of the standardized distribution
+     * for current α and β. Afterwards f, logf, F and S take tens of nanoseconds
+     * instead of numerical integration. Pieces, where the interpolant doesn't reach the tolerance
+     * at the check points between its nodes, and the tails beyond the series bounds are still evaluated exactly.
+     * Tables are kept on change of location and scale and dropped on change of α or β.
+     * Has effect only for α ≠ 1 and non-closed-form cases
+     * @param tolerance maximal absolute error of log-pdf and log-cdf in check points
+     */
+    void Tabulate(double tolerance = 1e-8);
+    /**
+     * @fn ClearTables
+     * return to exact evaluation of pdf and cdf
+     */
+    void ClearTables();
+    /**
+     * @fn IsTabulated
+     * @return true if pdf and cdf are evaluated by interpolation
+     */
+    inline bool IsTabulated() const { return !pdfTable.bounds.empty(); }
+
 protected:
+    /**
+     * @fn tabulate
+     * @param tolerance maximal absolute error of log-pdf and log-cdf in check points
+     * @param isCdfTabulated false if only log-pdf should be tabulated
+     */
+    void tabulate(double tolerance, bool isCdfTabulated);
+
     /**
      * @fn pdfNormal
      * @param x
@@ -173,6 +225,13 @@ private:
 
     DoublePair seriesZeroParams{};
 
+    /// number of elements in series expansions at infinity
+    static constexpr int TAIL_SERIES_SIZE = 10;
+    /// coefficients of series expansions of pdf at infinity for x < 0 and x > 0
+    std::array<std::array<double, TAIL_SERIES_SIZE>, 2> pdfTailCoefs{};
+    /// coefficients of series expansions of cdf at infinity for x < 0 and x > 0
+    std::array<std::array<double, TAIL_SERIES_SIZE>, 2> cdfTailCoefs{};
+
     /**
      * @fn pdfShortTailExpansionForGeneralExponent
      * @param logX
@@ -195,10 +254,10 @@ private:
     /**
      * @fn pdfSeriesExpansionAtInf
      * @param logX log(x)
-     * @param xiAdj adjusted ξ
+     * @param isRightTail true for x > 0
      * @return series expansion of probability density function for large x
      */
-    double pdfSeriesExpansionAtInf(double logX, double xiAdj) const;
+    double pdfSeriesExpansionAtInf(double logX, bool isRightTail) const;
     /**
      * @fn pdfTaylorExpansionTailNearCauchy
      * @param x
@@ -234,6 +293,31 @@ private:
      * @return value of probability density function for α ≠ 1
      */
     double pdfForGeneralExponent(double x) const;
+
+    /**
+     * @fn buildTable
+     * @param table
+     * @param fun function of t = sign(x) log(1 + |x|)
+     * @param breakpoints sorted boundaries of smooth parts of fun
+     * @param tolerance maximal absolute error in check points
+     */
+    static void buildTable(ChebyshevTable &table, const std::function<double (double)> &fun,
+                           const std::vector<double> &breakpoints, double tolerance);
+    /**
+     * @fn addTablePiece
+     * approximate fun on [a, b] or split the interval if the tolerance is not reached
+     * @param depth number of bisections performed before
+     * @param parentError error of the approximation before the last bisection
+     */
+    static void addTablePiece(ChebyshevTable &table, const std::function<double (double)> &fun,
+                              double a, double b, double tolerance, int depth, double parentError);
+    /**
+     * @fn evaluateTable
+     * @param table
+     * @param xSt standardized argument
+     * @return interpolated value or NAN if xSt is outside of table or in exactly evaluated piece
+     */
+    static double evaluateTable(const ChebyshevTable &table, double xSt);
 public:    
     double f(const double & x) const override;
     double logf(const double & x) const override;
@@ -303,12 +387,12 @@ private:
      */
     double cdfSeriesExpansionAtZero(double logX, double xiAdj, int k) const;
     /**
-     * @fn pdfSeriesExpansionAtInf
+     * @fn cdfSeriesExpansionAtInf
      * @param logX log(x)
-     * @param xiAdj adjusted ξ
+     * @param isRightTail true for x > 0
      * @return series expansion of cumulative distribution function for large x
      */
-    double cdfSeriesExpansionAtInf(double logX, double xiAdj) const;
+    double cdfSeriesExpansionAtInf(double logX, bool isRightTail) const;
     /**
      * @fn cdfIntegralRepresentation
      * @param absXSt absolute value of standardised x
@@ -427,10 +511,81 @@ private:
  */
 class RANDLIBSHARED_EXPORT StableRand : public StableDistribution
 {
+    /// tolerance of tables of density in profile likelihood
+    static constexpr double PROFILE_TOLERANCE = 1e-8;
+
 public:
     StableRand(double exponent = 2, double skewness = 0, double scale = 1, double location = 0) : StableDistribution(exponent, skewness, scale, location) {}
     String Name() const override;
     using StableDistribution::SetParameters;
+
+    /**
+     * @fn FitByQuantiles
+     * fit all parameters by estimator of J. H. McCulloch,
+     * based on 5%, 25%, 50%, 75% and 95% sample quantiles, for α in [0.5, 2]
+     * @param sample
+     */
+    void FitByQuantiles(const std::vector<double> &sample);
+
+    /**
+     * @fn FitByCharacteristicFunction
+     * fit all parameters by regression of I. A. Koutrouvelis on empirical characteristic function
+     * of the sample, standardized by quantile estimator, in points 0.1, 0.2, ..., 1
+     * (as proposed by S. M. Kogon and D. B. Williams)
+     * @param sample
+     */
+    void FitByCharacteristicFunction(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * fit all parameters via maximum-likelihood, starting from the estimator by characteristic function.
+     * Likelihood is profiled over (α, β) by derivative-free method: for each pair density is tabulated once
+     * and scale and location are fitted with fixed tables
+     * @param sample
+     */
+    void Fit(const std::vector<double> &sample);
+
+private:
+    /**
+     * @fn setEstimatedParameters
+     * set estimated parameters, moving α and β out of unsupported region around α = 1
+     * @param exponent
+     * @param skewness
+     * @param scale
+     * @param location
+     */
+    void setEstimatedParameters(double exponent, double skewness, double scale, double location);
+
+    /**
+     * @fn locationShift
+     * @param exponent
+     * @param skewness
+     * @param scale
+     * @return ζ - μ, where ζ is location of parameterization, continuous in α
+     */
+    static double locationShift(double exponent, double skewness, double scale);
+
+    /**
+     * @fn snapEstimatedExponent
+     * @param exponent estimated α
+     * @param sampleSize
+     * @return 1 if estimated α can't be distinguished from 1 for given sample size, α otherwise
+     */
+    static double snapEstimatedExponent(double exponent, size_t sampleSize);
+
+    /**
+     * @fn interpolateTable
+     * bilinear interpolation of the table, arguments are clamped to the grids
+     * @param xGrid ascending grid of rows
+     * @param xSize number of rows
+     * @param yGrid ascending grid of columns
+     * @param ySize number of columns
+     * @param table values in row-major order
+     * @param x
+     * @param y
+     * @return interpolated value
+     */
+    static double interpolateTable(const double *xGrid, size_t xSize, const double *yGrid, size_t ySize, const double *table, double x, double y);
 };
 
 
@@ -235,3 +235,84 @@ double StudentTRand::ExcessKurtosis() const
         return 6.0 / (nu - 4);
     return (nu > 2) ? INFINITY : NAN;
 }
+
+void StudentTRand::Fit(const std::vector<double> &sample)
+{
+    fit(sample, {});
+}
+
+void StudentTRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, "Number of weights should be equal to the sample size"));
+    fit(sample, weights);
+}
+
+void StudentTRand::fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (sample.empty())
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    /// Initial guess by method of moments: excess kurtosis is 6 / (ν - 4) and variance is σ^2 ν / (ν - 2)
+    double mean, variance, exkurtosis;
+    std::tie(mean, variance, std::ignore, exkurtosis) = weights.empty() ? GetSampleStatistics(sample) : GetSampleStatistics(sample, weights);
+    double degree = (exkurtosis > 0) ? 4.0 + 6.0 / exkurtosis : 30.0;
+    double scale = (variance > 0) ? std::sqrt(variance * (degree - 2) / degree) : 1.0;
+    std::vector<double> parameters = {degree, mean, scale};
+
+    MaximumLikelihoodFitter<double> fitter(*this, [this] (const std::vector<double> &theta)
+    {
+        SetDegree(theta[0]);
+        SetLocation(theta[1]);
+        SetScale(theta[2]);
+    },
+    {0.0, -INFINITY, 0.0}, {MAX_DEGREE, INFINITY, INFINITY},
+    [this] (const std::vector<double> &data, const std::vector<double> &w)
+    {
+        return logLikelihoodGradient(data, w);
+    });
+    bool converged = weights.empty() ? fitter.Fit(sample, parameters) : fitter.Fit(sample, weights, parameters);
+    if (!converged)
+        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in optimization procedure"));
+}
+
+std::vector<double> StudentTRand::LogLikelihoodGradient(const std::vector<double> &sample) const
+{
+    return logLikelihoodGradient(sample, {});
+}
+
+std::vector<double> StudentTRand::LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Log-likelihood gradient: number of weights should be equal to the sample size");
+    return logLikelihoodGradient(sample, weights);
+}
+
+std::vector<double> StudentTRand::logLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    /// d/dν = (ψ((ν + 1) / 2) - ψ(ν / 2) - 1 / ν - log(1 + z^2 / ν) + (ν + 1) z^2 / (ν (ν + z^2))) / 2,
+    /// d/dμ = (ν + 1) z / (σ (ν + z^2)), d/dσ = ((ν + 1) z^2 / (ν + z^2) - 1) / σ, where z = (x - μ) / σ
+    double sigmaInv = 1.0 / sigma, nuInv = 1.0 / nu;
+    auto [total, sumLog, sumRatio, sumZRatio] = sumOverSample<4>(sample, weights, [this, sigmaInv, nuInv] (double x)
+    {
+        double z = (x - mu) * sigmaInv;
+        double zSq = z * z;
+        double denominatorInv = 1.0 / (nu + zSq);
+        return std::array<double, 4>{1.0, std::log1p(zSq * nuInv), zSq * denominatorInv, z * denominatorInv};
+    });
+    double nup1 = nu + 1;
+    double gradDegree = total * (RandMath::digamma(nup1Half) - RandMath::digamma(0.5 * nu) - nuInv);
+    gradDegree += nup1 * nuInv * sumRatio - sumLog;
+    return {0.5 * gradDegree, nup1 * sumZRatio * sigmaInv, (nup1 * sumRatio - total) * sigmaInv};
+}
+
+std::vector<std::vector<double>> StudentTRand::FisherInformation() const
+{
+    double nup1 = nu + 1, nup3 = nu + 3;
+    double sigmaInv = 1.0 / sigma, sigmaInvSq = sigmaInv * sigmaInv;
+    double degreeInfo = 0.25 * (RandMath::trigamma(0.5 * nu) - RandMath::trigamma(nup1Half));
+    degreeInfo -= 0.5 * (nu + 5) / (nu * nup1 * nup3);
+    double cross = -2.0 * sigmaInv / (nup1 * nup3);
+    return {{degreeInfo, 0.0, cross},
+            {0.0, nup1 / nup3 * sigmaInvSq, 0.0},
+            {cross, 0.0, 2.0 * nu / nup3 * sigmaInvSq}};
+}
@@ -2,6 +2,7 @@
 #define STUDENTTRAND_H
 
 #include "NakagamiRand.h"
+#include "../MaximumLikelihoodFitter.h"
 
 /**
  * @brief The StudentTRand class <BR>
@@ -22,6 +23,9 @@ class RANDLIBSHARED_EXPORT StudentTRand : public ContinuousDistribution
     double nup1Half = 1; ///< 0.5 * (ν + 1)
     double logBetaFun = M_LNPI; ///< log(B(0.5 * ν, 0.5))
 
+    /// upper boundary of degree in fitting, beyond it the distribution is practically normal
+    static constexpr double MAX_DEGREE = 1e4;
+
 public:
     explicit StudentTRand(double degree = 1.0, double location = 0.0, double scale = 1.0);
 
@@ -56,6 +60,59 @@ private:
     double quantileImpl(double p) const override;
     double quantileImpl1m(double p) const override;
     std::complex<double> CFImpl(double t) const override;
+
+public:
+    /**
+     * @fn Fit
+     * fit degree, location and scale via maximum-likelihood
+     * @param sample
+     */
+    void Fit(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * fit degree, location and scale via maximum-likelihood for weighted sample
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @return gradient of log-likelihood function with respect to (ν, μ, σ)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample) const;
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return gradient of log-likelihood function for weighted sample with respect to (ν, μ, σ)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
+
+    /**
+     * @fn FisherInformation
+     * @return Fisher information matrix of one observation for (ν, μ, σ)
+     */
+    std::vector<std::vector<double>> FisherInformation() const;
+
+private:
+    /**
+     * @fn fit
+     * @param sample
+     * @param weights empty for unweighted sample
+     */
+    void fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn logLikelihoodGradient
+     * @param sample
+     * @param weights empty for unweighted sample
+     * @return gradient of log-likelihood function with respect to (ν, μ, σ)
+     */
+    std::vector<double> logLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
 };
 
 #endif // STUDENTTRAND_H
@@ -0,0 +1,304 @@
+#include "SumDistribution.h"
+
+SumDistribution::SumDistribution(const std::vector<const ContinuousDistribution *> &summands, const std::vector<int> &numbers,
+                                 double tail, int size)
+{
+    if (summands.empty())
+        throw std::invalid_argument("Sum distribution: there should be at least one summand");
+    if (numbers.size() != summands.size())
+        throw std::invalid_argument("Sum distribution: numbers of summands should be given for each distribution");
+    for (size_t i = 0; i != summands.size(); ++i) {
+        if (summands[i] == nullptr)
+            throw std::invalid_argument("Sum distribution: distribution of summand should be defined");
+        if (numbers[i] < 1)
+            throw std::invalid_argument("Sum distribution: number of summands should be positive");
+    }
+    if (tail <= 0.0 || tail >= 1.0)
+        throw std::invalid_argument("Sum distribution: tail probability should be in the interval (0, 1)");
+    components = summands;
+    multiplicities = numbers;
+    tailProbability = tail;
+    gridSize = size;
+    Update();
+}
+
+SumDistribution::SumDistribution(const std::vector<const ContinuousDistribution *> &summands, double tail, int size) :
+    SumDistribution(summands, std::vector<int>(summands.size(), 1), tail, size)
+{
+}
+
+String SumDistribution::Name() const
+{
+    String name = "Sum of (";
+    for (size_t i = 0; i != components.size(); ++i) {
+        if (i > 0)
+            name += ", ";
+        if (multiplicities[i] > 1)
+            name += toStringWithPrecision(multiplicities[i]) + " x ";
+        name += components[i]->Name();
+    }
+    return name + ")";
+}
+
+SUPPORT_TYPE SumDistribution::SupportType() const
+{
+    bool isLeftBounded = std::isfinite(MinValue()), isRightBounded = std::isfinite(MaxValue());
+    if (isLeftBounded)
+        return isRightBounded ? FINITE_T : RIGHTSEMIFINITE_T;
+    return isRightBounded ? LEFTSEMIFINITE_T : INFINITE_T;
+}
+
+double SumDistribution::MinValue() const
+{
+    double minValue = 0;
+    for (size_t i = 0; i != components.size(); ++i)
+        minValue += multiplicities[i] * components[i]->MinValue();
+    return minValue;
+}
+
+double SumDistribution::MaxValue() const
+{
+    double maxValue = 0;
+    for (size_t i = 0; i != components.size(); ++i)
+        maxValue += multiplicities[i] * components[i]->MaxValue();
+    return maxValue;
+}
+
+void SumDistribution::Update()
+{
+    /// By union bound, if all summands are within their (ε, 1 - ε)-quantiles, then the sum is within the sum of them
+    int number = 0;
+    for (int multiplicity : multiplicities)
+        number += multiplicity;
+    double epsilon = 0.5 * tailProbability / number;
+    double minPoint = 0, maxPoint = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        minPoint += multiplicities[i] * components[i]->Quantile(epsilon);
+        maxPoint += multiplicities[i] * components[i]->Quantile1m(epsilon);
+    }
+    double step = getScale() / POINTS_PER_SCALE;
+    if ((maxPoint - minPoint) / (gridSize - 1) <= step) {
+        SetGrid(minPoint, maxPoint, gridSize);
+        return;
+    }
+
+    /// Otherwise the grid is centered at the sum of centers of summands and the tails are approximated
+    std::vector<double> centers(components.size());
+    double center = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        centers[i] = 0.5 * (components[i]->Quantile(0.25) + components[i]->Quantile(0.75));
+        center += multiplicities[i] * centers[i];
+    }
+    double width = step * (gridSize - 1);
+    double left = std::max(center - 0.5 * width, minPoint);
+    double right = std::min(left + width, maxPoint);
+    SetGrid(std::max(right - width, minPoint), right, gridSize);
+    tailShifts.resize(components.size());
+    for (size_t i = 0; i != components.size(); ++i)
+        tailShifts[i] = center - centers[i];
+}
+
+void SumDistribution::SetGrid(double minPoint, double maxPoint, int size)
+{
+    grid = std::make_unique<FourierDensity>(*this, minPoint, maxPoint, size);
+    gridMin = minPoint;
+    gridMax = maxPoint;
+    gridSize = size;
+    tailShifts.clear();
+}
+
+double SumDistribution::getScale() const
+{
+    double variance = 0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        double range = components[i]->Quantile(0.75) - components[i]->Quantile(0.25);
+        variance += multiplicities[i] * range * range;
+    }
+    return std::sqrt(variance);
+}
+
+double SumDistribution::tailF(double x) const
+{
+    /// For subexponential summands the sum is far in the tail mostly because of one of them
+    double y = 0.0;
+    for (size_t i = 0; i != components.size(); ++i)
+        y += multiplicities[i] * components[i]->F(x - tailShifts[i]);
+    return std::min(y, 1.0);
+}
+
+double SumDistribution::tailS(double x) const
+{
+    double y = 0.0;
+    for (size_t i = 0; i != components.size(); ++i)
+        y += multiplicities[i] * components[i]->S(x - tailShifts[i]);
+    return std::min(y, 1.0);
+}
+
+double SumDistribution::tailf(double x) const
+{
+    double y = 0.0;
+    for (size_t i = 0; i != components.size(); ++i)
+        y += multiplicities[i] * components[i]->f(x - tailShifts[i]);
+    return y;
+}
+
+double SumDistribution::aliasingError(double x) const
+{
+    /// Cdf on the grid is obtained with sgn(x - X) replaced by the square wave of period 4L,
+    /// where L is the length of the grid, so that the mass at distances (2L, 4L), (6L, 8L), ... is counted wrong
+    double length = gridSize * (gridMax - gridMin) / (gridSize - 1);
+    double error = 0.0;
+    for (int k = 0; k != ALIASING_TERMS; ++k) {
+        double near = (4 * k + 2) * length, far = near + 2 * length;
+        error += tailS(x + near) - tailS(x + far);
+        error -= tailF(x - near) - tailF(x - far);
+    }
+    return error;
+}
+
+double SumDistribution::f(const double & x) const
+{
+    if (x < gridMin || x > gridMax)
+        return HasHeavyTails() ? tailf(x) : 0.0;
+    return grid->f(x);
+}
+
+double SumDistribution::logf(const double & x) const
+{
+    return std::log(f(x));
+}
+
+double SumDistribution::F(const double & x) const
+{
+    if (!HasHeavyTails()) {
+        if (x < gridMin)
+            return 0.0;
+        return (x > gridMax) ? 1.0 : grid->F(x);
+    }
+    if (x < gridMin)
+        return tailF(x);
+    if (x > gridMax)
+        return 1.0 - tailS(x);
+    return std::min(std::max(grid->F(x) - aliasingError(x), 0.0), 1.0);
+}
+
+double SumDistribution::S(const double & x) const
+{
+    if (!HasHeavyTails()) {
+        if (x < gridMin)
+            return 1.0;
+        return (x > gridMax) ? 0.0 : grid->S(x);
+    }
+    if (x < gridMin)
+        return 1.0 - tailF(x);
+    if (x > gridMax)
+        return tailS(x);
+    return std::min(std::max(grid->S(x) + aliasingError(x), 0.0), 1.0);
+}
+
+double SumDistribution::Variate() const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        for (int j = 0; j != multiplicities[i]; ++j)
+            sum += components[i]->Variate();
+    }
+    return sum;
+}
+
+void SumDistribution::Sample(std::vector<double> &outputData) const
+{
+    std::fill(outputData.begin(), outputData.end(), 0.0);
+    std::vector<double> summands(outputData.size());
+    for (size_t i = 0; i != components.size(); ++i) {
+        for (int j = 0; j != multiplicities[i]; ++j) {
+            components[i]->Sample(summands);
+            for (size_t k = 0; k != outputData.size(); ++k)
+                outputData[k] += summands[k];
+        }
+    }
+}
+
+double SumDistribution::Mean() const
+{
+    double mean = 0.0;
+    for (size_t i = 0; i != components.size(); ++i)
+        mean += multiplicities[i] * components[i]->Mean();
+    return mean;
+}
+
+double SumDistribution::Variance() const
+{
+    double variance = 0.0;
+    for (size_t i = 0; i != components.size(); ++i)
+        variance += multiplicities[i] * components[i]->Variance();
+    return variance;
+}
+
+double SumDistribution::Skewness() const
+{
+    /// Cumulants of independent summands are added
+    double thirdCumulant = 0.0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        double variance = components[i]->Variance();
+        thirdCumulant += multiplicities[i] * components[i]->Skewness() * variance * std::sqrt(variance);
+    }
+    double variance = Variance();
+    return thirdCumulant / (variance * std::sqrt(variance));
+}
+
+double SumDistribution::ExcessKurtosis() const
+{
+    double fourthCumulant = 0.0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        double variance = components[i]->Variance();
+        fourthCumulant += multiplicities[i] * components[i]->ExcessKurtosis() * variance * variance;
+    }
+    double variance = Variance();
+    return fourthCumulant / (variance * variance);
+}
+
+double SumDistribution::quantileImpl(double p) const
+{
+    /// Outside of the grid cdf is constant, unless the tails are approximated
+    if (HasHeavyTails())
+        return ContinuousDistribution::quantileImpl(p);
+    if (p <= grid->F(gridMin))
+        return gridMin;
+    if (p >= grid->F(gridMax))
+        return gridMax;
+    return ContinuousDistribution::quantileImpl(p);
+}
+
+double SumDistribution::quantileImpl1m(double p) const
+{
+    if (HasHeavyTails())
+        return ContinuousDistribution::quantileImpl1m(p);
+    if (p <= grid->S(gridMax))
+        return gridMax;
+    if (p >= grid->S(gridMin))
+        return gridMin;
+    return ContinuousDistribution::quantileImpl1m(p);
+}
+
+std::complex<double> SumDistribution::CFImpl(double t) const
+{
+    std::complex<double> y = 1.0;
+    for (size_t i = 0; i != components.size(); ++i) {
+        std::complex<double> phi = components[i]->CF(t);
+        y *= (multiplicities[i] == 1) ? phi : std::pow(phi, multiplicities[i]);
+    }
+    return y;
+}
+
+ConvolutionPower::ConvolutionPower(const ContinuousDistribution &summand, int number, double tail, int size) :
+    SumDistribution({&summand}, {number}, tail, size),
+    distribution(summand),
+    n(number)
+{
+}
+
+String ConvolutionPower::Name() const
+{
+    return toStringWithPrecision(n) + "-fold convolution of " + distribution.Name();
+}
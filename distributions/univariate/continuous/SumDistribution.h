@@ -0,0 +1,184 @@
+#ifndef SUMDISTRIBUTION_H
+#define SUMDISTRIBUTION_H
+
+#include "FourierDensity.h"
+#include <memory>
+
+/**
+ * @brief The SumDistribution class <BR>
+ * Distribution of sum of independent continuous random variables
+ *
+ * Notation: X ~ X_1 + X_2 + ... + X_n
+ *
+ * Characteristic function is a product of characteristic functions of summands,
+ * pdf and cdf are calculated on a grid by its FFT inversion (see FourierDensity) once
+ * and interpolated afterwards. By default the grid covers [Σ q_i(ε), Σ q_i(1 - ε)],
+ * where q_i are quantiles of summands and ε is tail probability divided by 2n,
+ * hence by union bound the probability to be outside of the grid doesn't exceed tail probability.
+ * Outside of the grid pdf is 0 and cdf is 0 or 1.
+ * If such grid is too sparse for the interquartile scale of the sum, then tails are heavy:
+ * the grid is centered at the body with bounded step and outside of it the sum is approximated
+ * by one summand in its tail and the others in their centers (F(x) ~ Σ F_i(x - c + c_i)).
+ * The same approximation corrects aliasing of cdf on the grid by far tails.
+ * Summands are stored by reference and grid should be updated after their parameters are changed.
+ */
+class RANDLIBSHARED_EXPORT SumDistribution : public ContinuousDistribution
+{
+    std::vector<const ContinuousDistribution *> components{}; ///< distributions of summands
+    std::vector<int> multiplicities{}; ///< number of summands with each distribution
+    double tailProbability = 1e-6; ///< upper bound of probability to be outside of the grid
+    int gridSize = 65536; ///< number of points in the grid
+    double gridMin = 0; ///< left boundary of the grid
+    double gridMax = 0; ///< right boundary of the grid
+    std::unique_ptr<FourierDensity> grid{}; ///< pdf and cdf on the grid
+    std::vector<double> tailShifts{}; ///< c - c_i for approximation of heavy tails, empty for light tails
+
+    /// minimal number of grid points per interquartile scale of the sum
+    static constexpr double POINTS_PER_SCALE = 32;
+    /// number of terms in the correction of aliasing by the tails
+    static constexpr int ALIASING_TERMS = 4;
+
+protected:
+    /**
+     * @fn SumDistribution
+     * @param summands distributions of summands
+     * @param numbers number of summands with each distribution
+     * @param tail upper bound of probability to be outside of the grid
+     * @param size number of points in the grid, should be power of 2
+     */
+    SumDistribution(const std::vector<const ContinuousDistribution *> &summands, const std::vector<int> &numbers,
+                    double tail, int size);
+
+public:
+    /**
+     * @fn SumDistribution
+     * @param summands distributions of summands
+     * @param tail upper bound of probability to be outside of the grid
+     * @param size number of points in the grid, should be power of 2
+     */
+    explicit SumDistribution(const std::vector<const ContinuousDistribution *> &summands,
+                             double tail = 1e-6, int size = 65536);
+    virtual ~SumDistribution() {}
+
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override;
+    double MinValue() const override;
+    double MaxValue() const override;
+
+    /**
+     * @fn Update
+     * recalculate the grid for current parameters of summands,
+     * choosing approximation of tails if they are too heavy for the grid
+     */
+    void Update();
+
+    /**
+     * @fn SetGrid
+     * recalculate pdf and cdf on the given grid, outside of which pdf is 0
+     * @param minPoint left boundary of the grid
+     * @param maxPoint right boundary of the grid
+     * @param size number of points in the grid, should be power of 2
+     */
+    void SetGrid(double minPoint, double maxPoint, int size);
+
+    /**
+     * @fn GetGridMin
+     * @return left boundary of the grid
+     */
+    inline double GetGridMin() const { return gridMin; }
+    /**
+     * @fn GetGridMax
+     * @return right boundary of the grid
+     */
+    inline double GetGridMax() const { return gridMax; }
+    /**
+     * @fn HasHeavyTails
+     * @return true if tails outside of the grid are approximated instead of being cut
+     */
+    inline bool HasHeavyTails() const { return !tailShifts.empty(); }
+
+    double f(const double & x) const override;
+    double logf(const double & x) const override;
+    double F(const double & x) const override;
+    double S(const double & x) const override;
+    double Variate() const override;
+    void Sample(std::vector<double> &outputData) const override;
+
+    double Mean() const override;
+    double Variance() const override;
+    double Skewness() const override;
+    double ExcessKurtosis() const override;
+
+private:
+    /**
+     * @fn getScale
+     * @return square root of sum of squared interquartile ranges of summands,
+     * which is interquartile range of the sum for normal summands and smaller for heavier tails
+     */
+    double getScale() const;
+
+    /**
+     * @fn tailF
+     * @param x
+     * @return cdf approximated by one summand being far in the left tail
+     */
+    double tailF(double x) const;
+    /**
+     * @fn tailS
+     * @param x
+     * @return survival function approximated by one summand being far in the right tail
+     */
+    double tailS(double x) const;
+    /**
+     * @fn tailf
+     * @param x
+     * @return pdf approximated by one summand being far in the tail
+     */
+    double tailf(double x) const;
+    /**
+     * @fn aliasingError
+     * @param x point of the grid
+     * @return error of cdf on the grid, caused by the mass further than the period of transform
+     */
+    double aliasingError(double x) const;
+
+    double quantileImpl(double p) const override;
+    double quantileImpl1m(double p) const override;
+    std::complex<double> CFImpl(double t) const override;
+};
+
+
+/**
+ * @brief The ConvolutionPower class <BR>
+ * Distribution of sum of n independent identically distributed continuous random variables
+ *
+ * Notation: Y ~ X^{*n}
+ *
+ * Distribution of summands is stored by reference and should outlive the convolution,
+ * hence temporary distributions are not accepted.
+ */
+class RANDLIBSHARED_EXPORT ConvolutionPower : public SumDistribution
+{
+    const ContinuousDistribution &distribution; ///< distribution of summands
+    int n = 1; ///< number of summands
+
+public:
+    /**
+     * @fn ConvolutionPower
+     * @param summand distribution of summands
+     * @param number number of summands
+     * @param tail upper bound of probability to be outside of the grid
+     * @param size number of points in the grid, should be power of 2
+     */
+    ConvolutionPower(const ContinuousDistribution &summand, int number, double tail = 1e-6, int size = 65536);
+    ConvolutionPower(const ContinuousDistribution &&summand, int number, double tail = 1e-6, int size = 65536) = delete;
+    String Name() const override;
+
+    /**
+     * @fn GetNumber
+     * @return number of summands
+     */
+    inline int GetNumber() const { return n; }
+};
+
+#endif // SUMDISTRIBUTION_H
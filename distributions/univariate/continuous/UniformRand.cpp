@@ -196,3 +196,32 @@ void UniformRand::Fit(const std::vector<double> &sample, bool unbiased)
         SetSupport(minVar, maxVar);
     }
 }
+
+void UniformRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights, bool unbiased)
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    FitFromStatistics(statistics, unbiased);
+}
+
+void UniformRand::FitFromStatistics(const SufficientStatistics &statistics, bool unbiased)
+{
+    checkStatistics(statistics, SufficientStatistics::MOMENTS);
+    double minVar = statistics.GetMin();
+    double maxVar = statistics.GetMax();
+    if (unbiased == true) {
+        double n = statistics.GetCount();
+        /// E[min] = b - n / (n + 1) * (b - a)
+        double minVarAdj = (minVar * n - maxVar) / (n - 1);
+        /// E[max] = (b - a) * n / (n + 1) + a
+        double maxVarAdj = (maxVar * n - minVar) / (n - 1);
+        if (!(minVarAdj <= minVar))
+            throw std::runtime_error(fitErrorDescription(WRONG_RETURN, TOO_LARGE_A + toStringWithPrecision(minVarAdj)));
+        if (!(maxVarAdj >= maxVar))
+            throw std::runtime_error(fitErrorDescription(WRONG_RETURN, TOO_SMALL_B + toStringWithPrecision(maxVarAdj)));
+        SetSupport(minVarAdj, maxVarAdj);
+    }
+    else {
+        SetSupport(minVar, maxVar);
+    }
+}
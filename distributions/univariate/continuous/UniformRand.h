@@ -75,6 +75,26 @@ public:
      * @param sample
      */
     void Fit(const std::vector<double> &sample, bool unbiased = false);
+    /**
+     * @fn Fit
+     * fit support for weighted (binned) sample, elements with zero weight are ignored
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @param unbiased
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights, bool unbiased = false);
+    /**
+     * @fn CreateStatistics
+     * @return empty accumulator of statistics, sufficient for FitFromStatistics
+     */
+    static SufficientStatistics CreateStatistics() { return SufficientStatistics(SufficientStatistics::MOMENTS); }
+    /**
+     * @fn FitFromStatistics
+     * fit support in the same way as Fit for the whole sample
+     * @param statistics
+     * @param unbiased
+     */
+    void FitFromStatistics(const SufficientStatistics &statistics, bool unbiased = false);
 };
 
 #endif // UNIFORMRAND_H
@@ -173,7 +173,7 @@ std::complex<double> WeibullRand::CFImpl(double t) const
     }
 
     /// For real part with k < 1 we split the integral on two intervals
-    double re1 = RandMath::integral([this, t] (double x)
+    double re1 = RandMath::integralAdaptiveSimpson([this, t] (double x)
     {
         if (x <= 0.0 || x > 1.0)
             return 0.0;
@@ -190,7 +190,7 @@ std::complex<double> WeibullRand::CFImpl(double t) const
     },
     1.0, INFINITY);
 
-    double re3 = t * RandMath::integral([this, t] (double x)
+    double re3 = t * RandMath::integralAdaptiveSimpson([this, t] (double x)
     {
         if (x <= 0.0)
             return 0.0;
@@ -215,3 +215,76 @@ double WeibullRand::Entropy() const
 {
     return M_EULER * (1.0 - kInv) + std::log(lambda * kInv) + 1.0;
 }
+
+void WeibullRand::Fit(const std::vector<double> &sample)
+{
+    fit(sample, {});
+}
+
+void WeibullRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, "Number of weights should be equal to the sample size"));
+    fit(sample, weights);
+}
+
+void WeibullRand::fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (sample.empty())
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    if (!allElementsArePositive(sample))
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, POSITIVITY_VIOLATION));
+    /// Initial guess: log(X) has Gumbel distribution for minimum with scale 1/k
+    auto [logMean, logVariance] = weights.empty() ? GetSampleLogMeanAndVariance(sample) : GetSampleLogMeanAndVariance(sample, weights);
+    double shape = (logVariance > 0) ? M_PI / std::sqrt(6 * logVariance) : 1.0;
+    double scale = std::exp(logMean + M_EULER / shape);
+    std::vector<double> parameters = {scale, shape};
+
+    MaximumLikelihoodFitter<double> fitter(*this, [this] (const std::vector<double> &theta)
+    {
+        SetParameters(theta[0], theta[1]);
+    },
+    {0.0, 0.0}, {INFINITY, INFINITY},
+    [this] (const std::vector<double> &data, const std::vector<double> &w)
+    {
+        return logLikelihoodGradient(data, w);
+    });
+    bool converged = weights.empty() ? fitter.Fit(sample, parameters) : fitter.Fit(sample, weights, parameters);
+    if (!converged)
+        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in optimization procedure"));
+}
+
+std::vector<double> WeibullRand::LogLikelihoodGradient(const std::vector<double> &sample) const
+{
+    return logLikelihoodGradient(sample, {});
+}
+
+std::vector<double> WeibullRand::LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Log-likelihood gradient: number of weights should be equal to the sample size");
+    return logLikelihoodGradient(sample, weights);
+}
+
+std::vector<double> WeibullRand::logLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const
+{
+    /// d/dλ = k / λ * ((x / λ)^k - 1), d/dk = 1 / k + log(x / λ) * (1 - (x / λ)^k)
+    double lambdaInv = 1.0 / lambda;
+    auto [total, sumPow, sumLog, sumLogPow] = sumOverSample<4>(sample, weights, [this, lambdaInv] (double x)
+    {
+        double logxAdj = std::log(x * lambdaInv);
+        double xAdjPow = std::exp(k * logxAdj);
+        return std::array<double, 4>{1.0, xAdjPow, logxAdj, logxAdj * xAdjPow};
+    });
+    return {k * lambdaInv * (sumPow - total), total * kInv + sumLog - sumLogPow};
+}
+
+std::vector<std::vector<double>> WeibullRand::FisherInformation() const
+{
+    /// E[Y log(Y)] = 1 - γ for standard exponential Y = (X / λ)^k
+    double lambdaInv = 1.0 / lambda, kInvSq = kInv * kInv;
+    double oneMinusEuler = 1.0 - M_EULER;
+    double cross = -oneMinusEuler * lambdaInv;
+    double shapeInfo = (oneMinusEuler * oneMinusEuler + M_PI_SQ / 6.0) * kInvSq;
+    return {{k * k * lambdaInv * lambdaInv, cross}, {cross, shapeInfo}};
+}
@@ -2,6 +2,7 @@
 #define WEIBULLRAND_H
 
 #include "ContinuousDistribution.h"
+#include "../MaximumLikelihoodFitter.h"
 
 /**
  * @brief The WeibullRand class <BR>
@@ -49,6 +50,58 @@ private:
 
 public:
     double Entropy() const;
+
+    /**
+     * @fn Fit
+     * fit scale and shape via maximum-likelihood
+     * @param sample
+     */
+    void Fit(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * fit scale and shape via maximum-likelihood for weighted sample
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @return gradient of log-likelihood function with respect to (λ, k)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample) const;
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return gradient of log-likelihood function for weighted sample with respect to (λ, k)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
+
+    /**
+     * @fn FisherInformation
+     * @return Fisher information matrix of one observation for (λ, k)
+     */
+    std::vector<std::vector<double>> FisherInformation() const;
+
+private:
+    /**
+     * @fn fit
+     * @param sample
+     * @param weights empty for unweighted sample
+     */
+    void fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+    /**
+     * @fn logLikelihoodGradient
+     * @param sample
+     * @param weights empty for unweighted sample
+     * @return gradient of log-likelihood function with respect to (λ, k)
+     */
+    std::vector<double> logLikelihoodGradient(const std::vector<double> &sample, const std::vector<double> &weights) const;
 };
 
 #endif // WEIBULLRAND_H
@@ -0,0 +1,138 @@
+#include "ZigguratSampler.h"
+#include "UniformRand.h"
+
+ZigguratSampler::ZigguratSampler(const Function &densityFunction, const Function &inverseDensityFunction, const Function &tailMassFunction,
+                                 bool isSymmetric, int numberOfLayers, const TailSampler &tailSamplerFunction) :
+    density(densityFunction),
+    inverseDensity(inverseDensityFunction),
+    tailMass(tailMassFunction),
+    tailSampler(tailSamplerFunction),
+    symmetric(isSymmetric),
+    layers(numberOfLayers)
+{
+    if (layers != 128 && layers != 256)
+        throw std::invalid_argument("Ziggurat sampler: number of layers should be 128 or 256");
+    double f0 = density(0);
+    if (!std::isfinite(f0) || f0 <= 0.0)
+        throw std::invalid_argument("Ziggurat sampler: density should be positive and finite in 0");
+    stairWidth.resize(layers + 1);
+    stairHeight.resize(layers);
+
+    /// bracket right boundary of the base layer
+    double a = 1.0, b = 1.0;
+    double ga = buildTables(a), gb = ga;
+    for (int iter = 0; ga >= 0.0; ++iter) {
+        if (iter == 1000)
+            throw std::invalid_argument("Ziggurat sampler: tables cannot be built");
+        b = a;
+        gb = ga;
+        a *= 0.5;
+        ga = buildTables(a);
+    }
+    for (int iter = 0; gb < 0.0; ++iter) {
+        if (iter == 1000)
+            throw std::invalid_argument("Ziggurat sampler: tables cannot be built");
+        a = b;
+        b *= 2;
+        gb = buildTables(b);
+    }
+    /// bisection
+    while (b - a > 1e-15 * b) {
+        double c = 0.5 * (a + b);
+        if (c <= a || c >= b)
+            break;
+        if (buildTables(c) < 0.0)
+            a = c;
+        else
+            b = c;
+    }
+    buildTables(b);
+    x1 = b;
+    /// close the top layer
+    stairHeight[layers - 1] = f0;
+    stairWidth[layers] = 0.0;
+}
+
+double ZigguratSampler::buildTables(double r)
+{
+    double f0 = density(0);
+    double fr = density(r);
+    double tail = tailMass(r);
+    /// area of each layer
+    double v = r * fr + tail;
+    if (!(v > 0.0) || !std::isfinite(v))
+        return 1.0;
+    stairHeight[0] = fr;
+    stairWidth[0] = v / fr;
+    stairWidth[1] = r;
+    for (int i = 1; i < layers - 1; ++i) {
+        stairHeight[i] = stairHeight[i - 1] + v / stairWidth[i];
+        if (stairHeight[i] >= f0)
+            return -1.0;
+        stairWidth[i + 1] = inverseDensity(stairHeight[i]);
+    }
+    return stairWidth[layers - 1] * (f0 - stairHeight[layers - 2]) - v;
+}
+
+double ZigguratSampler::variateTail(RandGenerator &randGenerator) const
+{
+    if (tailSampler)
+        return tailSampler(x1, randGenerator);
+    /// numerical inversion of tail mass, safeguarded by bisection
+    double target = UniformRand::StandardVariate(randGenerator) * tailMass(x1);
+    double a = x1, b = 2 * x1;
+    while (tailMass(b) > target) {
+        a = b;
+        b *= 2;
+    }
+    double x = 0.5 * (a + b);
+    for (int iter = 0; iter != 200 && b - a > 1e-14 * b; ++iter) {
+        double diff = tailMass(x) - target;
+        if (diff > 0)
+            a = x;
+        else
+            b = x;
+        double fx = density(x);
+        double next = (fx > 0.0) ? x + diff / fx : a;
+        x = (next > a && next < b) ? next : 0.5 * (a + b);
+    }
+    return x;
+}
+
+double ZigguratSampler::Variate(RandGenerator &randGenerator) const
+{
+    int iter = 0;
+    do {
+        unsigned long long B = randGenerator.Variate();
+        int stairId = B & (layers - 1);
+        bool isNegative = symmetric && (B & layers);
+        double x = UniformRand::StandardVariate(randGenerator) * stairWidth[stairId];
+        if (x < stairWidth[stairId + 1])
+            return isNegative ? -x : x;
+        if (stairId == 0) {
+            x = variateTail(randGenerator);
+            return isNegative ? -x : x;
+        }
+        /// handle the wedges of other stairs
+        double height = stairHeight[stairId] - stairHeight[stairId - 1];
+        if (stairHeight[stairId - 1] + height * UniformRand::StandardVariate(randGenerator) < density(x))
+            return isNegative ? -x : x;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return NAN; /// fail due to some error
+}
+
+double ZigguratSampler::Variate() const
+{
+    return Variate(localRandGenerator);
+}
+
+void ZigguratSampler::Sample(std::vector<double> &outputData) const
+{
+    for (double & var : outputData)
+        var = Variate(localRandGenerator);
+}
+
+void ZigguratSampler::Reseed(unsigned long seed) const
+{
+    localRandGenerator.Reseed(seed);
+}
@@ -0,0 +1,86 @@
+#ifndef ZIGGURATSAMPLER_H
+#define ZIGGURATSAMPLER_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The ZigguratSampler class <BR>
+ * Ziggurat algorithm by G. Marsaglia and W. W. Tsang
+ * for densities, which are non-increasing on [0, ∞)
+ * or symmetric around 0 and unimodal
+ *
+ * Tables are computed on construction from the density, its inverse and its tail mass.
+ * Most of the variates cost one random integer, one uniform variate and one comparison.
+ * Tail beyond the base layer is sampled by given sampler
+ * or, if it is absent, by numerical inversion of the tail mass.
+ */
+class RANDLIBSHARED_EXPORT ZigguratSampler
+{
+public:
+    typedef std::function<double (double)> Function;
+    typedef std::function<double (double, RandGenerator &)> TailSampler;
+
+private:
+    Function density; ///< density on [0, ∞), might be unnormalized
+    Function inverseDensity; ///< inverse of density on [0, ∞)
+    Function tailMass; ///< integral of density from x to ∞
+    TailSampler tailSampler; ///< sampler of x > r, given r
+    bool symmetric = false; ///< true if variates should get random sign
+    int layers = 256; ///< number of layers
+
+    std::vector<double> stairWidth{}; ///< width of ziggurat's stairs
+    std::vector<double> stairHeight{}; ///< height of ziggurat's stairs
+    double x1 = 0; ///< right boundary of the base layer
+
+    /// maximal number of iterations in rejection
+    static constexpr int MAX_ITER_REJECTION = 1000;
+
+    mutable RandGenerator localRandGenerator{};
+
+public:
+    /**
+     * @fn ZigguratSampler
+     * @param densityFunction non-increasing density on [0, ∞), f(0) should be finite
+     * @param inverseDensityFunction such x that f(x) = y, for y in (0, f(0)]
+     * @param tailMassFunction integral of density from x to ∞
+     * @param isSymmetric true if density is symmetric around 0 and variates should get random sign
+     * @param numberOfLayers 128 or 256
+     * @param tailSamplerFunction sampler from the tail beyond given point, if empty - numerical inversion is used
+     */
+    ZigguratSampler(const Function &densityFunction, const Function &inverseDensityFunction, const Function &tailMassFunction,
+                    bool isSymmetric, int numberOfLayers = 256, const TailSampler &tailSamplerFunction = TailSampler());
+
+    /**
+     * @fn GetStartingPoint
+     * @return right boundary of the base layer
+     */
+    inline double GetStartingPoint() const { return x1; }
+
+    double Variate() const;
+    double Variate(RandGenerator &randGenerator) const;
+    void Sample(std::vector<double> &outputData) const;
+
+    /**
+     * @brief Reseed
+     * @param seed
+     */
+    void Reseed(unsigned long seed) const;
+
+private:
+    /**
+     * @fn buildTables
+     * @param r right boundary of the base layer
+     * @return difference between area of the top layer and area of the other ones:
+     * negative if r is too small, positive if r is too large
+     */
+    double buildTables(double r);
+
+    /**
+     * @fn variateTail
+     * @param randGenerator
+     * @return variate from the tail beyond x1
+     */
+    double variateTail(RandGenerator &randGenerator) const;
+};
+
+#endif // ZIGGURATSAMPLER_H
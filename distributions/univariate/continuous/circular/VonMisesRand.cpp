@@ -158,3 +158,57 @@ double VonMisesRand::Mode() const
 {
     return loc;
 }
+
+void VonMisesRand::Fit(const std::vector<double> &sample)
+{
+    fit(sample, {});
+}
+
+void VonMisesRand::Fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, "Number of weights should be equal to the sample size"));
+    fit(sample, weights);
+}
+
+void VonMisesRand::fit(const std::vector<double> &sample, const std::vector<double> &weights)
+{
+    if (sample.empty())
+        throw std::invalid_argument(fitErrorDescription(TOO_FEW_ELEMENTS, "Sample should be non-empty"));
+    double sumCos = 0, sumSin = 0, total = 0;
+    for (size_t i = 0; i != sample.size(); ++i) {
+        double weight = weights.empty() ? 1.0 : weights[i];
+        sumCos += weight * std::cos(sample[i]);
+        sumSin += weight * std::sin(sample[i]);
+        total += weight;
+    }
+    /// Estimator of location is the circular mean, taken in the period which contains the sample
+    auto [minVar, maxVar] = std::minmax_element(sample.begin(), sample.end());
+    double location = std::atan2(sumSin, sumCos);
+    location += 2 * M_PI * std::round((0.5 * (*minVar + *maxVar) - location) / (2 * M_PI));
+    double meanResultant = std::sqrt(sumCos * sumCos + sumSin * sumSin) / total;
+    if (meanResultant == 0.0)
+        throw std::runtime_error(fitErrorDescription(WRONG_RETURN, "Mean resultant length should be positive"));
+
+    /// Initial guess of concentration by approximation of N. Fisher
+    double concentration = 0;
+    if (meanResultant < 0.53)
+        concentration = meanResultant * (2 + meanResultant * meanResultant * (1 + 5.0 / 6 * meanResultant * meanResultant));
+    else if (meanResultant < 0.85)
+        concentration = -0.4 + 1.39 * meanResultant + 0.43 / (1 - meanResultant);
+    else
+        concentration = 1.0 / (meanResultant * (3 + meanResultant * (meanResultant - 4)));
+
+    /// Likelihood equation A(k) = I_1(k) / I_0(k) = R is solved for t = log(k),
+    /// where A'(k) = 1 - A(k) / k - A(k)^2
+    double root = std::log(concentration);
+    if (!RandMath::findRootNewtonFirstOrder([meanResultant] (double t)
+    {
+        double kappa = std::exp(t);
+        double A = std::exp(RandMath::logBesselI(1, kappa) - RandMath::logBesselI(0, kappa));
+        return DoublePair(A - meanResultant, kappa * (1 - A * A) - A);
+    }, root))
+        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in root-finding procedure"));
+    SetLocation(location);
+    SetConcentration(std::exp(root));
+}
@@ -45,6 +45,29 @@ public:
 
 private:
     std::complex<double> CFImpl(double t) const override;
+public:
+    /**
+     * @fn Fit
+     * fit location and concentration via maximum-likelihood
+     * @param sample
+     */
+    void Fit(const std::vector<double> &sample);
+
+    /**
+     * @fn Fit
+     * fit location and concentration via maximum-likelihood for weighted sample
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<double> &sample, const std::vector<double> &weights);
+
+private:
+    /**
+     * @fn fit
+     * @param sample
+     * @param weights empty for unweighted sample
+     */
+    void fit(const std::vector<double> &sample, const std::vector<double> &weights);
 };
 
 #endif // VONMISESRAND_H
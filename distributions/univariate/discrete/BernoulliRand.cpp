@@ -69,18 +69,69 @@ int BernoulliRand::StandardVariate(RandGenerator &randGenerator)
     return X & 1;
 }
 
-void BernoulliRand::Sample(std::vector<int> &outputData) const
+unsigned long long BernoulliRand::PackedVariate(double probability, RandGenerator &randGenerator)
+{
+    if (probability <= 0.0)
+        return 0;
+    if (probability >= 1.0)
+        return ~0ULL;
+    /// bit j of the result is 1 iff U_j < p, where U_j is uniform variate
+    /// which binary digits are generated on demand
+    unsigned long long X = 0, undecided = ~0ULL;
+    double digits = probability;
+    do {
+        /// next binary digit of p (doubling is exact)
+        digits += digits;
+        unsigned long long R = randGenerator.Variate64();
+        if (digits >= 1.0) {
+            /// digit of U is 0 and digit of p is 1
+            X |= undecided & ~R;
+            undecided &= R;
+            digits -= 1.0;
+        }
+        else {
+            /// digit of U is 1 and digit of p is 0
+            undecided &= ~R;
+        }
+    } while (undecided && digits > 0.0);
+    /// if the rest of p's expansion is zero, then U_j >= p for all undecided j
+    return X;
+}
+
+void BernoulliRand::PackedSample(std::vector<unsigned long long> &outputData) const
 {
     if (p == 0.5) {
-        for (int & var : outputData)
-            var = StandardVariate(localRandGenerator);
+        for (unsigned long long & var : outputData)
+            var = localRandGenerator.Variate64();
     }
     else {
-        for (int & var : outputData)
-            var = this->Variate();
+        for (unsigned long long & var : outputData)
+            var = PackedVariate(p, localRandGenerator);
+    }
+}
+
+template < typename IntType >
+void BernoulliRand::unpackSample(std::vector<IntType> &outputData) const
+{
+    size_t size = outputData.size();
+    for (size_t i = 0; i < size; i += 64) {
+        unsigned long long X = (p == 0.5) ? localRandGenerator.Variate64() : PackedVariate(p, localRandGenerator);
+        size_t last = std::min(size, i + 64);
+        for (size_t j = i; j != last; ++j, X >>= 1)
+            outputData[j] = X & 1;
     }
 }
 
+void BernoulliRand::Sample(std::vector<int> &outputData) const
+{
+    unpackSample(outputData);
+}
+
+void BernoulliRand::Sample(std::vector<uint8_t> &outputData) const
+{
+    unpackSample(outputData);
+}
+
 double BernoulliRand::Entropy()
 {
     return -(p * logProb + q * log1mProb);
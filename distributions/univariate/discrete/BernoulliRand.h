@@ -2,6 +2,7 @@
 #define BERNOULLIRAND_H
 
 #include "BinomialRand.h"
+#include <cstdint>
 
 /**
  * @brief The BernoulliRand class <BR>
@@ -36,7 +37,39 @@ public:
     static int StandardVariate(RandGenerator &randGenerator = staticRandGenerator);
     void Sample(std::vector<int> &outputData) const override;
 
+    /**
+     * @fn Sample
+     * @param outputData vector of bytes, filled by 0 and 1
+     */
+    void Sample(std::vector<uint8_t> &outputData) const;
+
+    /**
+     * @fn PackedSample
+     * @param outputData bitset, each word contains 64 variates
+     * (i-th variate is stored in (i % 64)-th bit of (i / 64)-th word)
+     */
+    void PackedSample(std::vector<unsigned long long> &outputData) const;
+
+    /**
+     * @fn PackedVariate
+     * Compares bit-sliced binary expansions of 64 uniform variates with the one of p,
+     * using one random word for each digit until all of them are decided
+     * @param probability
+     * @param randGenerator
+     * @return 64 Bernoulli variates, packed in one word
+     */
+    static unsigned long long PackedVariate(double probability, RandGenerator &randGenerator = staticRandGenerator);
+
     inline double Entropy();
+
+private:
+    /**
+     * @fn unpackSample
+     * fill container by 0 and 1, unpacking 64 variates from each generated word
+     * @param outputData
+     */
+    template < typename IntType >
+    void unpackSample(std::vector<IntType> &outputData) const;
 };
 
 #endif // BERNOULLIRAND_H
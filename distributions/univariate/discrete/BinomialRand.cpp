@@ -399,6 +399,18 @@ void BinomialDistribution::FitProbability(const std::vector<int> &sample)
     SetParameters(n, GetSampleMean(sample) / n);
 }
 
+void BinomialDistribution::FitProbability(const std::vector<int> &sample, const std::vector<double> &weights)
+{
+    SufficientStatistics statistics(SufficientStatistics::MOMENTS);
+    statistics.Add(sample, weights);
+    checkStatistics(statistics, SufficientStatistics::MOMENTS);
+    if (statistics.GetMin() < 0)
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, NON_NEGATIVITY_VIOLATION));
+    if (statistics.GetMax() > n)
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, UPPER_LIMIT_VIOLATION + toStringWithPrecision(n)));
+    SetParameters(n, statistics.GetMean() / n);
+}
+
 BetaRand BinomialDistribution::FitProbabilityBayes(const std::vector<int> &sample, const BetaDistribution &priorDistribution)
 {
     if (!allElementsAreNonNegative(sample))
@@ -130,6 +130,14 @@ public:
      */
     void FitProbability(const std::vector<int> &sample);
 
+    /**
+     * @fn FitProbability
+     * Fit probability p with maximum-likelihood estimation for weighted (binned) sample
+     * @param sample distinct values
+     * @param weights non-negative frequencies of elements
+     */
+    void FitProbability(const std::vector<int> &sample, const std::vector<double> &weights);
+
     /**
      * @fn FitProbabilityBayes
      * Fit probability p with prior assumption p ~ Beta(α, β)
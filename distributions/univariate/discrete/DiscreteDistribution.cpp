@@ -42,57 +42,66 @@ int DiscreteDistribution::Mode() const
     return x;
 }
 
+int DiscreteDistribution::searchQuantile(double p, bool isComplementary) const
+{
+    /// returns such minimal k that F(k) >= p (or S(k) <= p if isComplementary)
+    auto isAbove = [this, p, isComplementary] (long long k)
+    {
+        return isComplementary ? (S(k) <= p) : (F(k) >= p);
+    };
+    long long minValue = MinValue(), maxValue = MaxValue();
+    long long guess = 0, step = 1;
+    double hint = getQuantileHint();
+    if (hint >= minValue && hint <= maxValue) {
+        /// warm start from the previous quantile in batch evaluation
+        guess = std::llround(hint);
+    }
+    else {
+        /// initial guess and step are taken from the first two moments
+        double mean = Mean(), var = Variance();
+        guess = std::isfinite(mean) ? std::llround(mean) : (isLeftBounded() ? minValue : 0);
+        guess = std::max(minValue, std::min(guess, maxValue));
+        if (std::isfinite(var) && var > 1.0)
+            step = std::llround(std::sqrt(var));
+    }
+    long long down = guess - 1, up = guess;
+    /// exponential search of the bracket (down, up]
+    if (isAbove(up)) {
+        while (down >= minValue && isAbove(down)) {
+            up = down;
+            down = std::max(down - step, minValue - 1);
+            step *= 2;
+        }
+    }
+    else {
+        down = up;
+        up = std::min(up + step, maxValue);
+        step *= 2;
+        while (up < maxValue && !isAbove(up)) {
+            down = up;
+            up = std::min(up + step, maxValue);
+            step *= 2;
+        }
+    }
+    /// bisection
+    while (up - down > 1) {
+        long long middle = down + (up - down) / 2;
+        if (isAbove(middle))
+            up = middle;
+        else
+            down = middle;
+    }
+    return up;
+}
+
 int DiscreteDistribution::quantileImpl(double p) const
 {
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<int> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end());
-    int guess = sample[index];
-    int down = static_cast<int>(std::floor(guess)), up = down + 1;
-    double fu = F(up), fd = F(down);
-    /// go up
-    while (fu < p) {
-        fd = fu;
-        fu = F(++up);
-    }
-    down = up - 1;
-    /// go down
-    while (fd > p) {
-        fd = F(--down);
-    }
-    up = down + 1;
-    /// if lower quantile is not equal probability, we return upper quantile
-    return (fd < p) ? up : down;
+    return searchQuantile(p, false);
 }
 
 int DiscreteDistribution::quantileImpl1m(double p) const
 {
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<int> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end(), std::greater<>());
-    int guess = sample[index];
-    int down = static_cast<int>(std::floor(guess)), up = down + 1;
-    double su = S(up), sd = S(down);
-    /// go up
-    while (su > p) {
-        sd = su;
-        su = S(++up);
-    }
-    down = up - 1;
-    /// go down
-    while (sd < p) {
-        sd = S(--down);
-    }
-    up = down + 1;
-
-    /// if lower quantile is not equal probability, we return upper quantile
-    return (sd > p) ? up : down;
+    return searchQuantile(p, true);
 }
 
 double DiscreteDistribution::ExpectedValue(const std::function<double (double)> &funPtr, int minPoint, int maxPoint) const
@@ -149,6 +158,23 @@ double DiscreteDistribution::LogLikelihoodFunction(const std::vector<int> &sampl
     return res;
 }
 
+double DiscreteDistribution::LikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const
+{
+    return std::exp(LogLikelihoodFunction(sample, weights));
+}
+
+double DiscreteDistribution::LogLikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Log-likelihood function: number of weights should be equal to the sample size");
+    double res = 0.0;
+    for (size_t i = 0; i != sample.size(); ++i) {
+        if (weights[i] > 0)
+            res += weights[i] * logP(sample[i]);
+    }
+    return res;
+}
+
 bool DiscreteDistribution::PearsonChiSquaredTest(const std::vector<int> &orderStatistic, double alpha, int lowerBoundary, int upperBoundary, size_t numberOfEstimatedParameters) const
 {
     size_t n = orderStatistic.size(), i = 0, k = 0;
@@ -47,6 +47,17 @@ public:
     int Mode() const override;
 
 private:
+    /**
+     * @fn searchQuantile
+     * Exponential search of the bracket, starting from the mean
+     * (or from the previous quantile inside of QuantileFunction),
+     * followed by bisection
+     * @param p
+     * @param isComplementary
+     * @return minimal k such that F(k) ≥ p (or S(k) ≤ p if isComplementary is true)
+     */
+    int searchQuantile(double p, bool isComplementary) const;
+
     int quantileImpl(double p) const override;
     int quantileImpl1m(double p) const override;
     double ExpectedValue(const std::function<double (double)> &funPtr, int minPoint, int maxPoint) const override;
@@ -68,6 +79,22 @@ public:
      */
     double LogLikelihoodFunction(const std::vector<int> &sample) const override;
 
+    /**
+     * @fn LikelihoodFunction
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return likelihood function of the distribution for given weighted sample
+     */
+    double LikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const override;
+
+    /**
+     * @fn LogLikelihoodFunction
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return log-likelihood function of the distribution for given weighted sample
+     */
+    double LogLikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const override;
+
     /**
      * @fn PearsonChiSquaredTest
      * @param orderStatistic sample sorted in ascending order
@@ -0,0 +1,109 @@
+#include "GuideTableSampler.h"
+#include "../continuous/UniformRand.h"
+
+GuideTableSampler::GuideTableSampler(const DiscreteDistribution &discreteDistribution, double tailMass) :
+    distribution(discreteDistribution)
+{
+    if (tailMass <= 0.0 || tailMass >= 0.5)
+        throw std::invalid_argument("Guide table sampler: mass of tails should be in interval (0, 0.5)");
+    epsilon = tailMass;
+    Update();
+}
+
+String GuideTableSampler::Name() const
+{
+    return "Guide table for " + distribution.Name();
+}
+
+void GuideTableSampler::Update()
+{
+    a = distribution.Quantile(epsilon);
+    int b = distribution.Quantile1m(epsilon);
+    long long size = static_cast<long long>(b) - a + 1;
+    if (size > MAX_TABLE_SIZE)
+        throw std::invalid_argument("Guide table sampler: support is too large to be tabulated, mass of tails should be increased");
+
+    /// cumulative probabilities from the left and from the right
+    int K = size;
+    std::vector<double> prob(K);
+    for (int i = 0; i != K; ++i)
+        prob[i] = distribution.P(a + i);
+    cdf.resize(K);
+    ccdf.resize(K);
+    lowerTail = distribution.F(a - 1);
+    double sum = lowerTail;
+    for (int i = 0; i != K; ++i) {
+        sum += prob[i];
+        cdf[i] = sum;
+    }
+    sum = distribution.S(b);
+    for (int i = K - 1; i >= 0; --i) {
+        ccdf[i] = sum;
+        sum += prob[i];
+    }
+
+    /// guide table
+    guide.resize(K);
+    int i = 0;
+    for (int j = 0; j != K; ++j) {
+        double level = static_cast<double>(j) / K;
+        while (i < K - 1 && cdf[i] < level)
+            ++i;
+        guide[j] = i;
+    }
+}
+
+double GuideTableSampler::F(const int & k) const
+{
+    long long i = static_cast<long long>(k) - a;
+    return (i < 0 || i >= static_cast<long long>(cdf.size())) ? distribution.F(k) : cdf[i];
+}
+
+double GuideTableSampler::S(const int & k) const
+{
+    long long i = static_cast<long long>(k) - a;
+    return (i < 0 || i >= static_cast<long long>(ccdf.size())) ? distribution.S(k) : ccdf[i];
+}
+
+int GuideTableSampler::invert(double p) const
+{
+    /// tails are rare and left for original distribution
+    if (p <= lowerTail || p > cdf.back())
+        return distribution.Quantile(p);
+    int K = cdf.size();
+    int j = p * K;
+    int i = guide[std::min(j, K - 1)];
+    while (cdf[i] < p)
+        ++i;
+    return a + i;
+}
+
+int GuideTableSampler::Variate() const
+{
+    return invert(UniformRand::StandardVariate(localRandGenerator));
+}
+
+void GuideTableSampler::Sample(std::vector<int> &outputData) const
+{
+    for (int & var : outputData)
+        var = invert(UniformRand::StandardVariate(localRandGenerator));
+}
+
+int GuideTableSampler::Median() const
+{
+    return invert(0.5);
+}
+
+int GuideTableSampler::quantileImpl(double p) const
+{
+    return invert(p);
+}
+
+int GuideTableSampler::quantileImpl1m(double p) const
+{
+    if (p < ccdf.back() || p >= 1.0 - lowerTail)
+        return distribution.Quantile1m(p);
+    /// ccdf is decreasing, find the first element which is not bigger than p
+    auto it = std::lower_bound(ccdf.begin(), ccdf.end(), p, std::greater<>());
+    return a + (it - ccdf.begin());
+}
@@ -0,0 +1,72 @@
+#ifndef GUIDETABLESAMPLER_H
+#define GUIDETABLESAMPLER_H
+
+#include "DiscreteDistribution.h"
+
+/**
+ * @brief The GuideTableSampler class <BR>
+ * Wrapper for any discrete distribution, which generates variates
+ * and calculates quantiles by inversion with the guide table of Chen and Asau
+ *
+ * Probabilities are tabulated on such interval [a, b], that F(a - 1) < ε and S(b) < ε,
+ * values out of this interval are taken from the original distribution.
+ * Expected number of comparisons for inversion is not larger than 2.
+ * Tables should be updated after parameters of original distribution are changed.
+ * Original distribution is stored by reference and should outlive the sampler,
+ * hence temporary distributions are not accepted.
+ */
+class RANDLIBSHARED_EXPORT GuideTableSampler : public DiscreteDistribution
+{
+    const DiscreteDistribution &distribution; ///< original distribution
+    double epsilon = 1e-10; ///< mass of truncated tails
+    int a = 0; ///< first tabulated value
+    std::vector<double> cdf{}; ///< F(a + i)
+    std::vector<double> ccdf{}; ///< S(a + i)
+    std::vector<int> guide{}; ///< guide[j] = min{i | F(a + i) ≥ j / m}
+    double lowerTail = 0; ///< F(a - 1)
+
+    /// maximal number of tabulated probabilities
+    static constexpr int MAX_TABLE_SIZE = 1 << 24;
+
+public:
+    explicit GuideTableSampler(const DiscreteDistribution &discreteDistribution, double tailMass = 1e-10);
+    explicit GuideTableSampler(const DiscreteDistribution &&discreteDistribution, double tailMass = 1e-10) = delete;
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override { return distribution.SupportType(); }
+    int MinValue() const override { return distribution.MinValue(); }
+    int MaxValue() const override { return distribution.MaxValue(); }
+
+    /**
+     * @fn Update
+     * rebuild tables for current parameters of the original distribution
+     */
+    void Update();
+
+    double P(const int & k) const override { return distribution.P(k); }
+    double logP(const int & k) const override { return distribution.logP(k); }
+    double F(const int & k) const override;
+    double S(const int & k) const override;
+    int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
+
+    double Mean() const override { return distribution.Mean(); }
+    double Variance() const override { return distribution.Variance(); }
+    int Median() const override;
+    int Mode() const override { return distribution.Mode(); }
+    double Skewness() const override { return distribution.Skewness(); }
+    double ExcessKurtosis() const override { return distribution.ExcessKurtosis(); }
+
+private:
+    /**
+     * @fn invert
+     * @param p
+     * @return minimal k such that F(k) ≥ p
+     */
+    int invert(double p) const;
+
+    int quantileImpl(double p) const override;
+    int quantileImpl1m(double p) const override;
+    std::complex<double> CFImpl(double t) const override { return distribution.CF(t); }
+};
+
+#endif // GUIDETABLESAMPLER_H
@@ -2,6 +2,7 @@
 #include "../continuous/UniformRand.h"
 #include "../continuous/ExponentialRand.h"
 #include "PoissonRand.h"
+#include <limits>
 
 template< typename T >
 NegativeBinomialDistribution<T>::NegativeBinomialDistribution(T number, double probability)
@@ -240,6 +241,59 @@ BetaRand NegativeBinomialDistribution<T>::FitProbabilityBayes(const std::vector<
     return posteriorDistribution;
 }
 
+template< typename T >
+std::vector<double> NegativeBinomialDistribution<T>::LogLikelihoodGradient(const std::vector<int> &sample) const
+{
+    return logLikelihoodGradient(sample, {});
+}
+
+template< typename T >
+std::vector<double> NegativeBinomialDistribution<T>::LogLikelihoodGradient(const std::vector<int> &sample, const std::vector<double> &weights) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Log-likelihood gradient: number of weights should be equal to the sample size");
+    return logLikelihoodGradient(sample, weights);
+}
+
+template< typename T >
+std::vector<double> NegativeBinomialDistribution<T>::logLikelihoodGradient(const std::vector<int> &sample, const std::vector<double> &weights) const
+{
+    /// d/dr = ψ(x + r) - ψ(r) + log(p), d/dp = r / p - x / (1 - p)
+    double number = r;
+    auto [total, sum, sumDigamma] = sumOverSample<3>(sample, weights, [number] (double x)
+    {
+        return std::array<double, 3>{1.0, x, RandMath::digamma(x + number)};
+    });
+    double gradNumber = sumDigamma + total * (logProb - RandMath::digamma(number));
+    double gradProbability = total * number / p - sum / q;
+    return {gradNumber, gradProbability};
+}
+
+template< typename T >
+std::vector<std::vector<double>> NegativeBinomialDistribution<T>::FisherInformation() const
+{
+    /// I_rr = ψ'(r) - E[ψ'(X + r)] = Σ P(X > k) / (r + k)^2,
+    /// probabilities are obtained by recursion in log-space, series is summed until the tail vanishes
+    double number = r;
+    double logProbability = number * logProb;
+    double survival = -std::expm1(logProbability);
+    double tolerance = std::numeric_limits<double>::epsilon();
+    double minSurvival = tolerance * survival;
+    int mode = Mode();
+    double numberInfo = 0;
+    for (int k = 0; k != INT_MAX; ++k) {
+        double rpk = number + k;
+        double term = survival / (rpk * rpk);
+        numberInfo += term;
+        if (k > mode && (survival <= minSurvival || term <= tolerance * numberInfo))
+            break;
+        logProbability += std::log(rpk / (k + 1)) + log1mProb;
+        survival -= std::exp(logProbability);
+    }
+    double cross = -1.0 / p;
+    return {{numberInfo, cross}, {cross, number / (p * p * q)}};
+}
+
 
 template< >
 String NegativeBinomialRand<int>::Name() const
@@ -270,15 +324,52 @@ void NegativeBinomialRand<double>::Fit(const std::vector<int> &sample)
         throw std::invalid_argument(fitErrorDescription(NOT_APPLICABLE, TOO_SMALL_VARIANCE));
     double guess = mean * mean / (variance - mean);
     size_t n = sample.size();
-    if (!RandMath::findRoot([sample, mean, n] (double x)
+    if (!RandMath::findRootNewtonFirstOrder([&sample, mean, n] (double x)
     {
         double first = 0.0, second = 0.0;
-        for (const double & var : sample) {
+        for (int var : sample) {
             first += RandMath::digamma(var + x);
             second += RandMath::trigamma(var + x);
         }
-        first -= n * (RandMath::digammamLog(x) + std::log(x + mean));
-        second -= n * (RandMath::trigamma(x) - mean / (x * (mean + x)));
+        /// equation is normalized by n, so that tolerance doesn't depend on the sample size
+        first = first / n - RandMath::digammamLog(x) - std::log(x + mean);
+        second = second / n - RandMath::trigamma(x) + mean / (x * (mean + x));
+        return DoublePair(first, second);
+    }, guess))
+        throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in root-finding algorithm"));
+    if (guess <= 0.0)
+        throw std::runtime_error(fitErrorDescription(WRONG_RETURN, "Number should be positive, but returned value is " + toStringWithPrecision(guess)));
+    SetParameters(guess, guess / (guess + mean));
+}
+
+template< >
+void NegativeBinomialRand<double>::Fit(const std::vector<int> &sample, const std::vector<double> &weights)
+{
+    /// Validation, mean and variance in one pass
+    SufficientStatistics statistics(SufficientStatistics::MOMENTS);
+    statistics.Add(sample, weights);
+    checkStatistics(statistics, SufficientStatistics::MOMENTS);
+    if (statistics.GetMin() < 0)
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, NON_NEGATIVITY_VIOLATION));
+    /// Initial guess by method of moments
+    double mean = statistics.GetMean(), variance = statistics.GetVariance();
+    /// Method can't be applied in the case of too small variance
+    if (variance <= mean)
+        throw std::invalid_argument(fitErrorDescription(NOT_APPLICABLE, TOO_SMALL_VARIANCE));
+    double guess = mean * mean / (variance - mean);
+    double n = statistics.GetCount();
+    if (!RandMath::findRootNewtonFirstOrder([&sample, &weights, mean, n] (double x)
+    {
+        double first = 0.0, second = 0.0;
+        for (size_t i = 0; i != sample.size(); ++i) {
+            if (weights[i] > 0) {
+                first += weights[i] * RandMath::digamma(sample[i] + x);
+                second += weights[i] * RandMath::trigamma(sample[i] + x);
+            }
+        }
+        /// equation is normalized by n, so that tolerance doesn't depend on the sample size
+        first = first / n - RandMath::digammamLog(x) - std::log(x + mean);
+        second = second / n - RandMath::trigamma(x) + mean / (x * (mean + x));
         return DoublePair(first, second);
     }, guess))
         throw std::runtime_error(fitErrorDescription(UNDEFINED_ERROR, "Error in root-finding algorithm"));
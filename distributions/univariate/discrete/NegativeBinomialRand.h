@@ -90,6 +90,36 @@ public:
      * @return posterior distribution
      */
     BetaRand FitProbabilityBayes(const std::vector<int> &sample, const BetaDistribution &priorDistribution);
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @return gradient of log-likelihood function with respect to (r, p)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<int> &sample) const;
+
+    /**
+     * @fn LogLikelihoodGradient
+     * @param sample
+     * @param weights non-negative frequencies of elements
+     * @return gradient of log-likelihood function for weighted sample with respect to (r, p)
+     */
+    std::vector<double> LogLikelihoodGradient(const std::vector<int> &sample, const std::vector<double> &weights) const;
+
+    /**
+     * @fn FisherInformation
+     * @return Fisher information matrix of one observation for (r, p)
+     */
+    std::vector<std::vector<double>> FisherInformation() const;
+
+private:
+    /**
+     * @fn logLikelihoodGradient
+     * @param sample
+     * @param weights empty for unweighted sample
+     * @return gradient of log-likelihood function with respect to (r, p)
+     */
+    std::vector<double> logLikelihoodGradient(const std::vector<int> &sample, const std::vector<double> &weights) const;
 };
 
 
@@ -114,6 +144,15 @@ public:
      * @param sample
      */
     void Fit(const std::vector<int> &sample);
+
+    /**
+     * @fn Fit
+     * set number and probability, estimated via maximum-likelihood method
+     * for weighted (binned) sample, each iteration costs O(number of distinct values)
+     * @param sample distinct values
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<int> &sample, const std::vector<double> &weights);
 };
 
 
@@ -263,6 +263,21 @@ void PoissonRand::Fit(const std::vector<int> &sample, DoublePair &confidenceInte
     confidenceInterval.second = ErlangRV.Quantile1m(halfAlpha);
 }
 
+void PoissonRand::Fit(const std::vector<int> &sample, const std::vector<double> &weights)
+{
+    SufficientStatistics statistics = CreateStatistics();
+    statistics.Add(sample, weights);
+    FitFromStatistics(statistics);
+}
+
+void PoissonRand::FitFromStatistics(const SufficientStatistics &statistics)
+{
+    checkStatistics(statistics, SufficientStatistics::MOMENTS);
+    if (statistics.GetMin() < 0)
+        throw std::invalid_argument(fitErrorDescription(WRONG_SAMPLE, NON_NEGATIVITY_VIOLATION));
+    SetRate(statistics.GetMean());
+}
+
 GammaRand PoissonRand::FitBayes(const std::vector<int> &sample, const GammaDistribution &priorDistribution)
 {
     if (!allElementsAreNonNegative(sample))
@@ -71,6 +71,13 @@ public:
      * @param sample
      */
     void Fit(const std::vector<int> &sample);
+    /**
+     * @fn Fit
+     * fit rate λ via maximum-likelihood method for weighted (binned) sample
+     * @param sample distinct values
+     * @param weights non-negative frequencies of elements
+     */
+    void Fit(const std::vector<int> &sample, const std::vector<double> &weights);
     /**
      * @brief Fit
      * @param sample
@@ -78,6 +85,17 @@ public:
      * @param significanceLevel
      */
     void Fit(const std::vector<int> &sample, DoublePair &confidenceInterval, double significanceLevel);
+    /**
+     * @fn CreateStatistics
+     * @return empty accumulator of statistics, sufficient for FitFromStatistics
+     */
+    static SufficientStatistics CreateStatistics() { return SufficientStatistics(SufficientStatistics::MOMENTS); }
+    /**
+     * @fn FitFromStatistics
+     * fit rate λ in the same way as Fit for the whole sample
+     * @param statistics
+     */
+    void FitFromStatistics(const SufficientStatistics &statistics);
     /**
      * @fn FitBayes
      * fit rate λ via Bayes estimation
@@ -32,6 +32,24 @@ int RademacherRand::Variate() const
     return BernoulliRand::StandardVariate(localRandGenerator) ? 1 : -1;
 }
 
+void RademacherRand::Sample(std::vector<int> &outputData) const
+{
+    /// one random word gives 64 variates
+    size_t size = outputData.size();
+    for (size_t i = 0; i < size; i += 64) {
+        unsigned long long X = localRandGenerator.Variate64();
+        size_t last = std::min(size, i + 64);
+        for (size_t j = i; j != last; ++j, X >>= 1)
+            outputData[j] = (X & 1) ? 1 : -1;
+    }
+}
+
+void RademacherRand::PackedSample(std::vector<unsigned long long> &outputData) const
+{
+    for (unsigned long long & var : outputData)
+        var = localRandGenerator.Variate64();
+}
+
 double RademacherRand::Mean() const
 {
     return 0;
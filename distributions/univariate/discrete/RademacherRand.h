@@ -28,6 +28,14 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
+
+    /**
+     * @fn PackedSample
+     * @param outputData bitset, each word contains 64 variates
+     * (bit 1 stands for 1 and bit 0 stands for -1)
+     */
+    void PackedSample(std::vector<unsigned long long> &outputData) const;
 
     double Mean() const override;
     double Variance() const override;
@@ -34,7 +34,8 @@ double SkellamRand::P(const int & k) const
 
 double SkellamRand::logP(const int & k) const
 {
-    double y = RandMath::logBesselI(k, 2 * sqrtMu1 * sqrtMu2);
+    /// I_{-k}(x) = I_k(x) for integer k
+    double y = RandMath::logBesselI(std::abs(k), 2 * sqrtMu1 * sqrtMu2);
     y += 0.5 * k * (logMu1 - logMu2);
     y -= mu1 + mu2;
     return y;
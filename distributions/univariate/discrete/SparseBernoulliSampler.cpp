@@ -0,0 +1,92 @@
+#include "SparseBernoulliSampler.h"
+#include "../continuous/ExponentialRand.h"
+
+SparseBernoulliSampler::SparseBernoulliSampler(double probability)
+{
+    SetProbability(probability);
+}
+
+void SparseBernoulliSampler::SetProbability(double probability)
+{
+    if (probability < 0.0 || probability > 1.0)
+        throw std::invalid_argument("Sparse Bernoulli sampler: probability parameter should in interval [0, 1]");
+    p = probability;
+    rateInv = -1.0 / std::log1p(-p);
+}
+
+double SparseBernoulliSampler::variateGap() const
+{
+    /// for small p we use hashed logarithm of 1 - p
+    /// and avoid integer overflow for large gaps
+    if (p < 0.05)
+        return std::floor(ExponentialRand::StandardVariate(localRandGenerator) * rateInv);
+    return GeometricRand::Variate(p, localRandGenerator);
+}
+
+void SparseBernoulliSampler::Sample(unsigned long long length, std::vector<unsigned long long> &indices) const
+{
+    indices.clear();
+    if (p == 0.0)
+        return;
+    double expectedSize = p * length;
+    indices.reserve(expectedSize + 3 * std::sqrt(expectedSize) + 1);
+    unsigned long long k = 0; /// next trial
+    while (k < length) {
+        double gap = variateGap();
+        if (gap >= length - k)
+            return;
+        k += gap;
+        indices.push_back(k);
+        ++k;
+    }
+}
+
+void SparseBernoulliSampler::ErdosRenyiGraph(int vertices, std::vector<size_t> &rowOffsets, std::vector<int> &columns) const
+{
+    if (vertices < 0)
+        throw std::invalid_argument("Sparse Bernoulli sampler: number of vertices should be non-negative");
+    rowOffsets.assign(vertices + 1, 0);
+    columns.clear();
+    if (p == 0.0 || vertices < 2)
+        return;
+
+    /// edges (v, w) with w < v in lexicographical order
+    std::vector<IntPair> edges;
+    double n = vertices;
+    double expectedSize = 0.5 * p * n * (n - 1);
+    edges.reserve(expectedSize + 3 * std::sqrt(expectedSize) + 1);
+    long long v = 1, w = -1;
+    while (v < vertices) {
+        double gap = variateGap();
+        /// there are less than n^2 pairs left
+        if (gap >= n * n)
+            break;
+        w += 1 + static_cast<long long>(gap);
+        while (w >= v && v < vertices) {
+            w -= v;
+            ++v;
+        }
+        if (v < vertices)
+            edges.emplace_back(v, w);
+    }
+
+    /// compressed sparse row format
+    for (const IntPair & edge : edges) {
+        ++rowOffsets[edge.first + 1];
+        ++rowOffsets[edge.second + 1];
+    }
+    std::partial_sum(rowOffsets.begin(), rowOffsets.end(), rowOffsets.begin());
+    columns.resize(rowOffsets[vertices]);
+    std::vector<size_t> position(rowOffsets.begin(), rowOffsets.end() - 1);
+    /// row i gets neighbours j < i first and then neighbours j > i,
+    /// both in ascending order
+    for (const IntPair & edge : edges) {
+        columns[position[edge.first]++] = edge.second;
+        columns[position[edge.second]++] = edge.first;
+    }
+}
+
+void SparseBernoulliSampler::Reseed(unsigned long seed) const
+{
+    localRandGenerator.Reseed(seed);
+}
@@ -0,0 +1,57 @@
+#ifndef SPARSEBERNOULLISAMPLER_H
+#define SPARSEBERNOULLISAMPLER_H
+
+#include "GeometricRand.h"
+
+/**
+ * @brief The SparseBernoulliSampler class <BR>
+ * Sampler of the positions of successes in a sequence of Bernoulli trials
+ *
+ * Instead of generating every trial, gaps between successes are drawn
+ * from the geometric distribution, therefore the cost is proportional
+ * to the number of successes rather than to the number of trials
+ */
+class RANDLIBSHARED_EXPORT SparseBernoulliSampler
+{
+    double p = 0.5; ///< probability of success
+    double rateInv = M_LOG2E; ///< -1 / log(1 - p)
+
+    mutable RandGenerator localRandGenerator{};
+
+    /**
+     * @fn variateGap
+     * @return number of failures before the next success
+     */
+    double variateGap() const;
+
+public:
+    explicit SparseBernoulliSampler(double probability = 0.5);
+
+    void SetProbability(double probability);
+    inline double GetProbability() const { return p; }
+
+    /**
+     * @fn Sample
+     * @param length number of trials
+     * @param indices sorted positions of successes in [0, length)
+     */
+    void Sample(unsigned long long length, std::vector<unsigned long long> &indices) const;
+
+    /**
+     * @fn ErdosRenyiGraph
+     * Batagelj-Brandes algorithm for random graph G(n, p)
+     * @param vertices number of vertices n
+     * @param rowOffsets output of size n + 1:
+     * neighbours of vertex i are columns[rowOffsets[i]], ..., columns[rowOffsets[i + 1] - 1]
+     * @param columns output: neighbours of all vertices, sorted within each row
+     */
+    void ErdosRenyiGraph(int vertices, std::vector<size_t> &rowOffsets, std::vector<int> &columns) const;
+
+    /**
+     * @brief Reseed
+     * @param seed
+     */
+    void Reseed(unsigned long seed) const;
+};
+
+#endif // SPARSEBERNOULLISAMPLER_H
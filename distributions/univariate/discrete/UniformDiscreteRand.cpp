@@ -18,12 +18,9 @@ void UniformDiscreteRand::SetBoundaries(int minValue, int maxValue)
     a = minValue;
     b = maxValue;
 
-    n = b - a + 1;
+    n = static_cast<long long>(b) - a + 1;
     nInv = 1.0 / n;
     logN = std::log(n);
-
-    unsigned long long MAX_RAND = localRandGenerator.MaxValue();
-    MAX_RAND_UNBIASED = MAX_RAND - MAX_RAND % n - 1;
 }
 
 double UniformDiscreteRand::P(const int & k) const
@@ -47,11 +44,74 @@ double UniformDiscreteRand::F(const int & k) const
 
 int UniformDiscreteRand::Variate() const
 {
-    unsigned long intVar;
-    do {
-        intVar = localRandGenerator.Variate();
-    } while (intVar > MAX_RAND_UNBIASED);
-    return a + (intVar % n);
+    return a + static_cast<long long>(StandardVariate(n, localRandGenerator));
+}
+
+unsigned long long UniformDiscreteRand::multiply(unsigned long long x, unsigned long long y, unsigned long long &low)
+{
+    static constexpr unsigned long long MASK32 = 0xFFFFFFFFULL;
+    unsigned long long xLow = x & MASK32, xHigh = x >> 32;
+    unsigned long long yLow = y & MASK32, yHigh = y >> 32;
+    unsigned long long ll = xLow * yLow, lh = xLow * yHigh;
+    unsigned long long hl = xHigh * yLow, hh = xHigh * yHigh;
+    unsigned long long middle = (ll >> 32) + (lh & MASK32) + (hl & MASK32);
+    low = (middle << 32) | (ll & MASK32);
+    return hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+}
+
+unsigned long long UniformDiscreteRand::StandardVariate(unsigned long long number, RandGenerator &randGenerator)
+{
+    /// D. Lemire, "Fast Random Integer Generation in an Interval"
+    /// multiply random word by number and take the upper part,
+    /// rejection (and division) is required only for small lower part
+    if (number <= 1)
+        return 0;
+    if (randGenerator.MaxValue() <= 4294967295ULL && number <= 4294967296ULL) {
+        /// one 32-bit variate is enough
+        if (number == 4294967296ULL)
+            return randGenerator.Variate();
+        unsigned long long m = randGenerator.Variate() * number;
+        unsigned int low = m;
+        if (low < number) {
+            unsigned int threshold = (4294967296ULL - number) % number;
+            while (low < threshold) {
+                m = randGenerator.Variate() * number;
+                low = m;
+            }
+        }
+        return m >> 32;
+    }
+    unsigned long long low = 0;
+    unsigned long long high = multiply(randGenerator.Variate64(), number, low);
+    if (low < number) {
+        unsigned long long threshold = (0 - number) % number;
+        while (low < threshold)
+            high = multiply(randGenerator.Variate64(), number, low);
+    }
+    return high;
+}
+
+void UniformDiscreteRand::Sample(std::vector<int> &outputData) const
+{
+    /// Lemire's method with the rejection threshold calculated once for the whole sample
+    if (localRandGenerator.MaxValue() <= 4294967295ULL && n < 4294967296ULL) {
+        unsigned int threshold = (4294967296ULL - n) % n;
+        for (int & var : outputData) {
+            unsigned long long m = localRandGenerator.Variate() * n;
+            while (static_cast<unsigned int>(m) < threshold)
+                m = localRandGenerator.Variate() * n;
+            var = a + static_cast<long long>(m >> 32);
+        }
+        return;
+    }
+    unsigned long long threshold = (0 - static_cast<unsigned long long>(n)) % n;
+    for (int & var : outputData) {
+        unsigned long long low = 0;
+        unsigned long long high = multiply(localRandGenerator.Variate64(), n, low);
+        while (low < threshold)
+            high = multiply(localRandGenerator.Variate64(), n, low);
+        var = a + static_cast<long long>(high);
+    }
 }
 
 double UniformDiscreteRand::Mean() const
@@ -125,3 +185,21 @@ double UniformDiscreteRand::LogLikelihoodFunction(const std::vector<int> &sample
     }
     return -sample.size() * logN;
 }
+
+double UniformDiscreteRand::LikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const
+{
+    return std::exp(LogLikelihoodFunction(sample, weights));
+}
+
+double UniformDiscreteRand::LogLikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const
+{
+    if (weights.size() != sample.size())
+        throw std::invalid_argument("Log-likelihood function: number of weights should be equal to the sample size");
+    double weightSum = 0.0;
+    for (size_t i = 0; i != sample.size(); ++i) {
+        if (weights[i] > 0 && (sample[i] < a || sample[i] > b))
+            return -INFINITY;
+        weightSum += weights[i];
+    }
+    return -weightSum * logN;
+}
@@ -19,7 +19,6 @@ class RANDLIBSHARED_EXPORT UniformDiscreteRand : public DiscreteDistribution
     int b = 0; ///< max bound
     double nInv = 1; ///< 1/n
     double logN = 0; ///< log(n)
-    unsigned long long MAX_RAND_UNBIASED = localRandGenerator.MaxValue();///< constant for unbiased generator
 
 public:
     UniformDiscreteRand(int minValue = 0, int maxValue = 1);
@@ -34,6 +33,15 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     int Variate() const override;
+    /**
+     * @fn StandardVariate
+     * Lemire's nearly divisionless method
+     * @param number
+     * @param randGenerator
+     * @return random integer, uniformly distributed on [0, number - 1]
+     */
+    static unsigned long long StandardVariate(unsigned long long number, RandGenerator &randGenerator = staticRandGenerator);
+    void Sample(std::vector<int> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -43,12 +51,23 @@ public:
     double ExcessKurtosis() const override;
 
 private:
+    /**
+     * @fn multiply
+     * @param x
+     * @param y
+     * @param low lower 64 bits of x * y
+     * @return upper 64 bits of x * y
+     */
+    static unsigned long long multiply(unsigned long long x, unsigned long long y, unsigned long long &low);
+
     std::complex<double> CFImpl(double t) const override;
 
 public:
     double Entropy() const;
     double LikelihoodFunction(const std::vector<int> &sample) const override;
     double LogLikelihoodFunction(const std::vector<int> &sample) const override;
+    double LikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const override;
+    double LogLikelihoodFunction(const std::vector<int> &sample, const std::vector<double> &weights) const override;
 };
 
 #endif // UNIFORM_DISCRETE_RAND_H
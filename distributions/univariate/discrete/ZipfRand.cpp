@@ -34,6 +34,34 @@ void ZipfRand::SetParameters(double exponent, int number)
         table[hashedVarNum - 1] = table[hashedVarNum - 2] + std::pow(hashedVarNum, -s);
     for (int i = 0; i < hashedVarNum; ++i)
         table[i] *= invHarmonicNumber;
+
+    hIntegralX1 = hIntegral(1.5) - 1.0;
+    hIntegralN = hIntegral(n + 0.5);
+    squeeze = 2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0));
+}
+
+double ZipfRand::h(double x) const
+{
+    return std::exp(-s * std::log(x));
+}
+
+double ZipfRand::hIntegral(double x) const
+{
+    /// (x^(1-s) - 1) / (1 - s), computed stably for s close to 1
+    double logX = std::log(x);
+    double y = (1.0 - s) * logX;
+    double expm1y = (std::fabs(y) > 1e-8) ? std::expm1(y) / y : 1.0 + 0.5 * y * (1.0 + y / 3.0);
+    return expm1y * logX;
+}
+
+double ZipfRand::hIntegralInverse(double x) const
+{
+    double t = x * (1.0 - s);
+    /// t < -1 can happen only due to rounding errors
+    if (t < -1.0)
+        t = -1.0;
+    double log1pt = (std::fabs(t) > 1e-8) ? std::log1p(t) / t : 1.0 - t * (0.5 - t / 3.0);
+    return std::exp(log1pt * x);
 }
 
 double ZipfRand::P(const int & k) const
@@ -55,24 +83,27 @@ double ZipfRand::F(const int & k) const
     return RandMath::harmonicNumber(s, k) * invHarmonicNumber;
 }
 
+int ZipfRand::variateRejectionInversion() const
+{
+    int iter = 0;
+    do {
+        double U = UniformRand::StandardVariate(localRandGenerator);
+        double u = hIntegralN + U * (hIntegralX1 - hIntegralN);
+        double x = hIntegralInverse(u);
+        int k = std::max(1.0, std::min(std::round(x), static_cast<double>(n)));
+        if (k - x <= squeeze || u >= hIntegral(k + 0.5) - h(k))
+            return k;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1; /// return if algorithm doesn't work
+}
+
 int ZipfRand::Variate() const
 {
+    if (n > hashedVarNum)
+        return variateRejectionInversion();
+    /// binary search in the table of cumulative probabilities
     double U = UniformRand::StandardVariate(localRandGenerator);
-    int k = 1;
-    /// if we didn't manage to hash values for such U
-    if (U > table[hashedVarNum - 1]) {
-        k = hashedVarNum;
-        double sum = table[hashedVarNum - 1];
-        do {
-            ++k;
-            sum += std::pow(k, -s) * invHarmonicNumber;
-        } while (sum < U);
-    }
-    else {
-        while (k <= hashedVarNum && table[k - 1] < U)
-            ++k;
-    }
-    return k;
+    return std::lower_bound(table, table + hashedVarNum - 1, U) - table + 1;
 }
 
 double ZipfRand::Mean() const
@@ -20,6 +20,11 @@ class RANDLIBSHARED_EXPORT ZipfRand : public DiscreteDistribution
     int hashedVarNum = 1;
     double table[tableSize];
 
+    /// constants for rejection-inversion
+    double hIntegralX1 = 0; ///< H(1.5) - 1
+    double hIntegralN = 0; ///< H(n + 0.5)
+    double squeeze = 0; ///< 2 - H^(-1)(H(2.5) - 2^(-s))
+
 public:
     ZipfRand(double exponent, int number);
     String Name() const override;
@@ -43,6 +48,35 @@ public:
     double ExcessKurtosis() const override;
 
 private:
+    /**
+     * @fn h
+     * @param x
+     * @return x^(-s)
+     */
+    double h(double x) const;
+
+    /**
+     * @fn hIntegral
+     * @param x
+     * @return H(x) = (x^(1-s) - 1) / (1 - s), antiderivative of h(x)
+     */
+    double hIntegral(double x) const;
+
+    /**
+     * @fn hIntegralInverse
+     * @param x
+     * @return such y that H(y) = x
+     */
+    double hIntegralInverse(double x) const;
+
+    /**
+     * @fn variateRejectionInversion
+     * W. Hörmann and G. Derflinger, "Rejection-inversion to generate variates
+     * from monotone discrete distributions"
+     * @return Zipf variate in O(1) expected time
+     */
+    int variateRejectionInversion() const;
+
     std::complex<double> CFImpl(double t) const override;
 };
 
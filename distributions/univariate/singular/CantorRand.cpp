@@ -73,7 +73,7 @@ double CantorRand::Variance() const
 double CantorRand::quantileImpl(double p) const
 {
     double root = p;
-    if (RandMath::findRoot([this, p] (double x)
+    if (RandMath::findRootBrent([this, p] (double x)
     {
         return F(x) - p;
     }, 0.0, 1.0, root))
@@ -84,7 +84,7 @@ double CantorRand::quantileImpl(double p) const
 double CantorRand::quantileImpl1m(double p) const
 {
     double root = 1.0 - p;
-    if (RandMath::findRoot([this, p] (double x)
+    if (RandMath::findRootBrent([this, p] (double x)
     {
         double y = F(x) - 1;
         return y + p;
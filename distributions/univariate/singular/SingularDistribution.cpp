@@ -29,3 +29,13 @@ double SingularDistribution::LogLikelihoodFunction(const std::vector<double> &)
 {
     return NAN;
 }
+
+double SingularDistribution::LikelihoodFunction(const std::vector<double> &, const std::vector<double> &) const
+{
+    return NAN;
+}
+
+double SingularDistribution::LogLikelihoodFunction(const std::vector<double> &, const std::vector<double> &) const
+{
+    return NAN;
+}
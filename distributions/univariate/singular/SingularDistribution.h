@@ -19,6 +19,8 @@ private:
     double ExpectedValue(const std::function<double (double)> &funPtr, double minPoint, double maxPoint) const override;
     double LikelihoodFunction(const std::vector<double> &sample) const override;
     double LogLikelihoodFunction(const std::vector<double> &sample) const override;
+    double LikelihoodFunction(const std::vector<double> &sample, const std::vector<double> &weights) const override;
+    double LogLikelihoodFunction(const std::vector<double> &sample, const std::vector<double> &weights) const override;
 };
 
 
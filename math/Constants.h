@@ -103,7 +103,7 @@ constexpr long double M_1_E       = 0.36787944117144232160l;
 #endif
 
 #ifndef M_LNPI
-constexpr long double M_LNPI      = 1.14472988585494001741l;
+constexpr long double M_LNPI      = 1.14472988584940017414l;
 #endif
 
 #ifndef M_EULER
@@ -20,6 +20,71 @@ namespace RandMath
 double integral(const std::function<double (double)> &funPtr, double a, double b,
                             double epsilon = 1e-11, int maxRecursionDepth = 11);
 
+/**
+ * @fn integralAdaptiveSimpson
+ * Adaptive Simpson's method, integrand is inlined
+ * @param funPtr integrand
+ * @param a lower boundary
+ * @param b upper boundary
+ * @param epsilon tolerance
+ * @param maxRecursionDepth how deep should the algorithm go
+ * @return
+ */
+template <typename Function>
+double integralAdaptiveSimpson(const Function &funPtr, double a, double b,
+                               double epsilon = 1e-11, int maxRecursionDepth = 11);
+
+/**
+ * @fn integralGaussKronrod
+ * Non-recursive adaptive Gauss-Kronrod quadrature (G7K15):
+ * the interval with the largest error estimate is bisected until
+ * the total error estimate is smaller than tolerance
+ * @param funPtr integrand
+ * @param a finite lower boundary
+ * @param b finite upper boundary
+ * @param epsilon absolute tolerance, which is also relative for large integrals
+ * @param maxIntervals maximal number of subintervals
+ * @return
+ */
+template <typename Function>
+double integralGaussKronrod(const Function &funPtr, double a, double b, double epsilon = 1e-11, int maxIntervals = 1000);
+
+/**
+ * @fn tanhSinhNodes
+ * @return nodes y = 1 - tanh(π/2 sinh(t)) and weights of tanh-sinh quadrature for t ≥ 0,
+ * grouped by levels of step halving
+ */
+const std::vector<std::vector<DoublePair>> &tanhSinhNodes();
+
+/**
+ * @fn expSinhNodes
+ * @return nodes x = exp(π/2 sinh(t)) and factors π/2 cosh(t) of exp-sinh quadrature for t ≥ 0,
+ * grouped by levels of step halving
+ */
+const std::vector<std::vector<DoublePair>> &expSinhNodes();
+
+/**
+ * @fn sinhSinhNodes
+ * @return nodes x = sinh(π/2 sinh(t)) and weights of sinh-sinh quadrature for t ≥ 0,
+ * grouped by levels of step halving
+ */
+const std::vector<std::vector<DoublePair>> &sinhSinhNodes();
+
+/**
+ * @fn integralTanhSinh
+ * Double exponential quadrature: tanh-sinh for finite interval,
+ * exp-sinh for semi-infinite and sinh-sinh for infinite one.
+ * Integrand is never evaluated at the boundaries,
+ * therefore it can have singularities there
+ * @param funPtr integrand
+ * @param a lower boundary, might be -∞
+ * @param b upper boundary, might be ∞
+ * @param epsilon absolute tolerance, which is also relative for large integrals
+ * @return
+ */
+template <typename Function>
+double integralTanhSinh(const Function &funPtr, double a, double b, double epsilon = 1e-11);
+
 /**
  * @fn findRoot
  * Newton's root-finding procedure,
@@ -32,6 +97,19 @@ double integral(const std::function<double (double)> &funPtr, double a, double b
  */
 bool findRoot(const std::function<DoubleTriplet (double)> &funPtr, double & root, double funTol = 1e-10, double stepTol = 1e-6);
 
+/**
+ * @fn findRootNewtonSecondOrder
+ * Newton's root-finding procedure,
+ * using first and second derivatives, function is inlined
+ * @param funPtr mapping x |-> (f(x), f'(x), f''(x))
+ * @param root starting point in input and such x that f(x) = 0 in output
+ * @param funTol function tolerance
+ * @param stepTol step tolerance
+ * @return true if success, false otherwise
+ */
+template <typename Function>
+bool findRootNewtonSecondOrder(const Function &funPtr, double & root, double funTol = 1e-10, double stepTol = 1e-6);
+
 /**
  * @fn findRoot
  * Newton's root-finding procedure,
@@ -44,6 +122,19 @@ bool findRoot(const std::function<DoubleTriplet (double)> &funPtr, double & root
  */
 bool findRoot(const std::function<DoublePair (double)> &funPtr, double & root, double funTol = 1e-10, double stepTol = 1e-6);
 
+/**
+ * @fn findRootNewtonFirstOrder
+ * Newton's root-finding procedure,
+ * using first derivative, function is inlined
+ * @param funPtr mapping x |-> (f(x), f'(x))
+ * @param root starting point in input and such x that f(x) = 0 in output
+ * @param funTol function tolerance
+ * @param stepTol step tolerance
+ * @return true if success, false otherwise
+ */
+template <typename Function>
+bool findRootNewtonFirstOrder(const Function &funPtr, double & root, double funTol = 1e-10, double stepTol = 1e-6);
+
 /**
  * @fn findRoot
  * Newton's root-finding procedure
@@ -59,6 +150,21 @@ bool findRoot(const std::function<DoublePair (double)> &funPtr, double & root, d
 bool findRoot(const std::function<DoublePair (DoublePair)> &funPtr, const std::function<std::tuple<DoublePair, DoublePair> (DoublePair)> &gradPtr,
               DoublePair & root, double funTol = 1e-10, double stepTol = 1e-6);
 
+/**
+ * @fn findRootNewton2D
+ * Newton's root-finding procedure
+ * for 2 functions of 2 parameters,
+ * using Jacobian matrix, functions are inlined
+ * @param funPtr mapping x, y |-> (f(x, y), g(x, y))
+ * @param gradPtr x, y |-> (f_x(x, y), f_y(x, y), g_x(x, y)), g_y(x, y))
+ * @param root starting point in input and such x that f(x) = 0 in output
+ * @param funTol function tolerance
+ * @param stepTol step tolerance
+ * @return true if success, false otherwise
+ */
+template <typename Function, typename Gradient>
+bool findRootNewton2D(const Function &funPtr, const Gradient &gradPtr, DoublePair & root, double funTol = 1e-10, double stepTol = 1e-6);
+
 /**
  * @fn findRoot
  * Brent's root-finding procedure
@@ -71,6 +177,19 @@ bool findRoot(const std::function<DoublePair (DoublePair)> &funPtr, const std::f
  */
 bool findRoot(const std::function<double (double)> &funPtr, double a, double b, double & root, double epsilon = 1e-8);
 
+/**
+ * @fn findRootBrent
+ * Brent's root-finding procedure, function is inlined
+ * @param funPtr mapping x |-> f(x)
+ * @param a lower boundary
+ * @param b upper boundary
+ * @param root starting point and such x that f(x) = 0
+ * @param epsilon tolerance
+ * @return true if success, false otherwise
+ */
+template <typename Function>
+bool findRootBrent(const Function &funPtr, double a, double b, double & root, double epsilon = 1e-8);
+
 /**
  * @fn findMin
  * Combined Brent's method
@@ -83,6 +202,19 @@ bool findRoot(const std::function<double (double)> &funPtr, double a, double b,
  */
 bool findMin(const std::function<double (double)> &funPtr, const DoubleTriplet &abc, const DoubleTriplet &fabc, double &root, double epsilon = 1e-8);
 
+/**
+ * @fn findMinBrent
+ * Combined Brent's method, function is inlined
+ * @param funPtr
+ * @param abc lower boundary / middle / upper boundary
+ * @param fabc funPtr(abc)
+ * @param root such x that funPtr(x) is min
+ * @param epsilon tolerance
+ * @return true if success
+ */
+template <typename Function>
+bool findMinBrent(const Function &funPtr, const DoubleTriplet &abc, const DoubleTriplet &fabc, double &root, double epsilon = 1e-8);
+
 /**
  * @fn findMin
  * Combined Brent's method
@@ -94,6 +226,924 @@ bool findMin(const std::function<double (double)> &funPtr, const DoubleTriplet &
  */
 bool findMin(const std::function<double (double)> &funPtr, double closePoint, double &root, double epsilon = 1e-8);
 
+/**
+ * @fn findMinBrent
+ * Combined Brent's method, function is inlined
+ * @param funPtr
+ * @param closePoint point that is nearby minimum
+ * @param root such x that funPtr(x) is min
+ * @param epsilon tolerance
+ * @return true if success
+ */
+template <typename Function>
+bool findMinBrent(const Function &funPtr, double closePoint, double &root, double epsilon = 1e-8);
+
+/**
+ * @fn findMinNelderMead
+ * Nelder-Mead simplex method with adaptive parameters (F. Gao and L. Han),
+ * trial points are projected onto the box [lowerBounds, upperBounds]
+ * @param funPtr mapping x |-> f(x), which can return infinity outside of the domain
+ * @param point starting point in input and such x that f(x) is min in output
+ * @param lowerBounds lower boundaries of coordinates
+ * @param upperBounds upper boundaries of coordinates
+ * @param funTol tolerance of function values in simplex
+ * @param stepTol relative tolerance of simplex size
+ * @param maxIter maximal number of iterations
+ * @return true if success, false otherwise
+ */
+template <typename Function>
+bool findMinNelderMead(const Function &funPtr, std::vector<double> &point, const std::vector<double> &lowerBounds,
+                       const std::vector<double> &upperBounds, double funTol = 1e-12, double stepTol = 1e-8, int maxIter = 20000);
+
+/**
+ * @fn findMinLBFGSB
+ * Limited-memory BFGS method for box constraints:
+ * quasi-Newton direction by two-loop recursion in the space of free coordinates,
+ * projected backtracking line search with Armijo condition
+ * @param funPtr mapping x |-> (f(x), ∇f(x))
+ * @param point starting point in input and such x that f(x) is min in output
+ * @param lowerBounds lower boundaries of coordinates
+ * @param upperBounds upper boundaries of coordinates
+ * @param gradTol tolerance of projected gradient
+ * @param funTol relative tolerance of function decrease
+ * @param maxIter maximal number of iterations
+ * @param memory number of stored corrections
+ * @return true if success, false otherwise
+ */
+template <typename Function>
+bool findMinLBFGSB(const Function &funPtr, std::vector<double> &point, const std::vector<double> &lowerBounds,
+                   const std::vector<double> &upperBounds, double gradTol = 1e-8, double funTol = 1e-12, int maxIter = 1000, int memory = 7);
+
+/**
+ * @fn fft
+ * In-place iterative radix-2 fast Fourier transform:
+ * y[k] = Σ x[n] exp(∓2πink/N), where the sign is negative for forward transform.
+ * Inverse transform is not normalized
+ * @param data vector, which size is power of 2
+ * @param inverse
+ */
+void fft(std::vector<std::complex<double>> &data, bool inverse = false);
+
+
+/**
+ * @fn adaptiveSimpsonsAux
+ * auxiliary function for calculation of integral
+ * @param funPtr
+ * @param a lower boundary
+ * @param b upper boundary
+ * @param epsilon
+ * @param S
+ * @param fa
+ * @param fb
+ * @param fc
+ * @param bottom
+ * @return
+ */
+template <typename Function>
+double adaptiveSimpsonsAux(const Function &funPtr, double a, double b,
+                           double epsilon, double S, double fa, double fb, double fc, int bottom)
+{
+    double c = .5 * (a + b), h = (b - a) / 12.0;
+    double d = .5 * (a + c), e = .5 * (c + b);
+    double fd = funPtr(d), fe = funPtr(e);
+    double Sleft = h * (fa + 4 * fd + fc);
+    double Sright = h * (fc + 4 * fe + fb);
+    double S2 = Sleft + Sright;
+    if (bottom <= 0 || std::fabs(S2 - S) <= 15.0 * epsilon)
+        return S2 + (S2 - S) / 15.0;
+    epsilon *= .5;
+    --bottom;
+
+    return adaptiveSimpsonsAux(funPtr, a, c, epsilon, Sleft, fa, fc, fd, bottom) +
+           adaptiveSimpsonsAux(funPtr, c, b, epsilon, Sright, fc, fb, fe, bottom);
+}
+template <typename Function>
+double integralAdaptiveSimpson(const Function &funPtr, double a, double b, double epsilon, int maxRecursionDepth)
+{
+    if (a > b)
+        return -integralAdaptiveSimpson(funPtr, b, a, epsilon, maxRecursionDepth);
+    if (a == b)
+        return 0.0;
+    double c = .5 * (a + b), h = (b - a) / 6.0;
+    double fa = funPtr(a), fb = funPtr(b), fc = funPtr(c);
+    double S = h * (fa + 4 * fc + fb);
+    return adaptiveSimpsonsAux(funPtr, a, b, epsilon, S, fa, fb, fc, maxRecursionDepth);
+}
+template <typename Function>
+bool findRootNewtonSecondOrder(const Function &funPtr, double &root, double funTol, double stepTol)
+{
+    /// Sanity check
+    funTol = funTol > MIN_POSITIVE ? funTol : MIN_POSITIVE;
+    stepTol = stepTol > MIN_POSITIVE ? stepTol : MIN_POSITIVE;
+    static constexpr int MAX_ITER = 1e5;
+    static constexpr double MAX_STEP = 10;
+    int iter = 0;
+    double step = stepTol + 1;
+    auto [f, fx, fxx] = funPtr(root);
+    if (std::fabs(f) < MIN_POSITIVE)
+        return true;
+    do {
+        double alpha = 1.0;
+        double oldRoot = root;
+        double oldFun = f;
+        double numerator = 2 * f * fx;
+        double denominator = 2 * fx * fx - f * fxx;
+        step = std::min(MAX_STEP, std::max(-MAX_STEP, numerator / denominator));
+        do {
+            root = oldRoot - alpha * step;
+            std::tie(f, fx, fxx) = funPtr(root);
+            if (std::fabs(f) < MIN_POSITIVE)
+                return true;
+            alpha *= 0.5;
+        } while ((std::fabs(fx) <= MIN_POSITIVE || std::fabs(oldFun) < std::fabs(f)) && alpha > 0);
+        /// Check convergence criteria
+        double diffX = std::fabs(root - oldRoot);
+        double relDiffX = std::fabs(diffX / oldRoot);
+        if (std::min(diffX, relDiffX) < stepTol) {
+            double diffY = f - oldFun;
+            double relDiffY = std::fabs(diffY / oldFun);
+            if (std::min(std::fabs(f), relDiffY) < funTol)
+                return true;
+        }
+    } while (++iter < MAX_ITER);
+    return false;
+}
+template <typename Function>
+bool findRootNewtonFirstOrder(const Function &funPtr, double &root, double funTol, double stepTol)
+{
+    /// Sanity check
+    funTol = funTol > MIN_POSITIVE ? funTol : MIN_POSITIVE;
+    stepTol = stepTol > MIN_POSITIVE ? stepTol : MIN_POSITIVE;
+    static constexpr int MAX_ITER = 1e5;
+    static constexpr double MAX_STEP = 10;
+    int iter = 0;
+    double step = stepTol + 1;
+    DoublePair y = funPtr(root);
+    double fun = y.first;
+    double grad = y.second;
+    if (std::fabs(fun) < MIN_POSITIVE)
+        return true;
+    do {
+        double alpha = 1.0;
+        double oldRoot = root;
+        double oldFun = fun;
+        step = std::min(MAX_STEP, std::max(-MAX_STEP, fun / grad));
+        do {
+            root = oldRoot - alpha * step;
+            y = funPtr(root);
+            fun = y.first;
+            grad = y.second;
+            if (std::fabs(fun) < MIN_POSITIVE)
+                return true;
+            alpha *= 0.5;
+        } while ((std::fabs(grad) <= MIN_POSITIVE || std::fabs(oldFun) < std::fabs(fun)) && alpha > 0);
+        /// Check convergence criteria
+        double diffX = std::fabs(root - oldRoot);
+        double relDiffX = std::fabs(diffX / oldRoot);
+        if (std::min(diffX, relDiffX) < stepTol) {
+            double diffY = fun - oldFun;
+            double relDiffY = std::fabs(diffY / oldFun);
+            if (std::min(std::fabs(fun), relDiffY) < funTol)
+                return true;
+        }
+    } while (++iter < MAX_ITER);
+    return false;
+}
+template <typename Function, typename Gradient>
+bool findRootNewton2D(const Function &funPtr, const Gradient &gradPtr, DoublePair &root, double funTol, double stepTol)
+{
+    /// Sanity check
+    funTol = funTol > MIN_POSITIVE ? funTol : MIN_POSITIVE;
+    stepTol = stepTol > MIN_POSITIVE ? stepTol : MIN_POSITIVE;
+    static constexpr int MAX_ITER = 1e5;
+    static constexpr double MAX_STEP = 10;
+    int iter = 0;
+    double step1 = stepTol + 1, step2 = step1;
+    DoublePair fun = funPtr(root);
+    double fun1 = fun.first;
+    double fun2 = fun.second;
+    double error = std::max(std::fabs(fun1), std::fabs(fun2));
+    if (error < MIN_POSITIVE)
+        return true;
+
+    auto [grad1, grad2] = gradPtr(root);
+    do {
+        double alpha = 1.0;
+        DoublePair oldRoot = root;
+        DoublePair oldFun = fun;
+        double oldError = error;
+        double det = grad1.first * grad2.second - grad1.second * grad2.first;
+        step1 = std::min(MAX_STEP, std::max(-MAX_STEP, (grad2.second * fun1 - grad1.second * fun2) / det));
+        step2 = std::min(MAX_STEP, std::max(-MAX_STEP, (-grad2.first * fun1 + grad1.first * fun2) / det));
+        do {
+            root.first = oldRoot.first - alpha * step1;
+            root.second = oldRoot.second - alpha * step2;
+            fun = funPtr(root);
+            fun1 = fun.first;
+            fun2 = fun.second;
+            error = std::max(std::fabs(fun1), std::fabs(fun2));
+            if (error < MIN_POSITIVE)
+                return true;
+            std::tie(grad1, grad2) = gradPtr(root);
+            det = grad1.first * grad2.second - grad1.second * grad2.first;
+            alpha *= 0.5;
+        } while ((std::fabs(det) <= MIN_POSITIVE || oldError < error) && alpha > 0);
+
+        /// Check convergence criteria
+        double diffX1 = std::fabs(root.first - oldRoot.first);
+        double diffX2 = std::fabs(root.second - oldRoot.second);
+        double diffX = std::max(diffX1, diffX2);
+        double relDiffX1 = std::fabs(diffX1 / oldRoot.first);
+        double relDiffX2 = std::fabs(diffX2 / oldRoot.second);
+        double relDiffX = std::max(relDiffX1, relDiffX2);
+        if (std::min(diffX, relDiffX) < stepTol)
+        {
+            double diffY1 = fun1- oldFun.first;
+            double diffY2 = fun2 - oldFun.second;
+            double relDiffY1 = std::fabs(diffY1 / oldFun.first);
+            double relDiffY2 = std::fabs(diffY2 / oldFun.second);
+            double relDiffY = std::max(relDiffY1, relDiffY2);
+            if (std::min(std::max(std::fabs(fun1), std::fabs(fun2)), relDiffY) < funTol)
+                return true;
+        }
+    } while (++iter < MAX_ITER);
+    return false;
+}
+template <typename Function>
+bool findRootBrent(const Function &funPtr, double a, double b, double &root, double epsilon)
+{
+    /// Sanity check
+    epsilon = epsilon > MIN_POSITIVE ? epsilon : MIN_POSITIVE;
+    double fa = funPtr(a);
+    if (fa == 0) {
+        root = a;
+        return true;
+    }
+    double fb = funPtr(b);
+    if (fb == 0) {
+        root = b;
+        return true;
+    }
+    if (fa * fb > 0) {
+        /// error - the root is not bracketed
+        return false;
+    }
+    if (std::fabs(fa) < std::fabs(fb)) {
+        std::swap(a, b);
+        std::swap(fa, fb);
+    }
+    double c = a, fc = fa;
+    bool mflag = true;
+    double s = b, fs = 1, d = 0;
+    while (std::fabs(b - a) > epsilon) {
+        if (!areClose(fc, fa) && !areClose(fb, fc))
+        {
+            /// inverse quadratic interpolation
+            double numerator = a * fb * fc;
+            double denominator = (fa - fb) * (fa - fc);
+            s = numerator / denominator;
+            numerator = b * fa * fc;
+            denominator = (fb - fa) * (fb - fc);
+            s += numerator / denominator;
+            numerator = c * fa * fb;
+            denominator = (fc - fa) * (fc - fb);
+            s += numerator / denominator;
+        }
+        else {
+            /// secant method
+            s = b - fb * (b - a) / (fb - fa);
+        }
+        double absDiffSB2 = std::fabs(s - b);
+        absDiffSB2 += absDiffSB2;
+        double absDiffBC = std::fabs(b - c);
+        double absDiffCD = std::fabs(c - d);
+        if (s < 0.25 * (3 * a + b) || s > b ||
+            (mflag && absDiffSB2 >= absDiffBC) ||
+            (!mflag && absDiffSB2 >= absDiffCD) ||
+            (mflag && absDiffBC < epsilon) ||
+            (!mflag && absDiffCD < epsilon))
+        {
+            s = 0.5 * (a + b);
+            mflag = true;
+        }
+        else {
+            mflag = false;
+        }
+        fs = funPtr(s);
+        if (std::fabs(fs) < epsilon) {
+            root = s;
+            return true;
+        }
+        d = c;
+        c = b;
+        fc = fb;
+        if (fa * fs < 0) {
+            b = s;
+            fb = fs;
+        }
+        else {
+            a = s;
+            fa = fs;
+        }
+        if (std::fabs(fa) < std::fabs(fb)) {
+            std::swap(a, b);
+            std::swap(fa, fb);
+        }
+    }
+    root = (std::fabs(fs) < std::fabs(fb)) ? s : b;
+    return true;
+}
+/**
+ * @fn parabolicMinimum
+ * @param a < b < c
+ * @param fa f(a)
+ * @param fb f(b)
+ * @param fc f(c)
+ * @return minimum of interpolated parabola
+ */
+inline double parabolicMinimum(double a, double b, double c, double fa, double fb, double fc)
+{
+    double bma = b - a, cmb = c - b;
+    double aux1 = bma * (fb - fc);
+    double aux2 = cmb * (fb - fa);
+    double numerator = bma * aux1 - cmb * aux2;
+    double denominator = aux1 + aux2;
+    return b - 0.5 * numerator / denominator;
+}
+/**
+ * @fn findBounds
+ * Search of segment that contains the minimum of function
+ * @param funPtr mapping x |-> f(x)
+ * @param abc such points, that a < b < c, f(a) > f(b) and f(c) > f(b)
+ * @param fabc values of a, b and c
+ * @param startPoint
+ * @return true when segment is found, segment itself and its function values
+ */
+template <typename Function>
+bool findBounds(const Function &funPtr, DoubleTriplet &abc, DoubleTriplet &fabc, double startPoint)
+{
+    static constexpr double K = 0.5 * (M_SQRT5 + 1);
+    static constexpr int L = 100;
+    double a = startPoint, fa = funPtr(a);
+    double b = a + 1.0, fb = funPtr(b);
+    double c, fc;
+    if (fb < fa) {
+        c = b + K * (b - a);
+        fc = funPtr(c);
+        /// we go to the right
+        while (fc < fb) {
+            /// parabolic interpolation
+            double u = parabolicMinimum(a, b, c, fa, fb, fc);
+            double cmb = c - b;
+            double fu, uLim = c + L * cmb;
+            if (u < c && u > b) {
+                fu = funPtr(u);
+                if (fu < fc) {
+                    abc = std::make_tuple(b, u, c);
+                    fabc = std::make_tuple(fb, fu, fc);
+                    return true;
+                }
+                if (fu > fb) {
+                    abc = std::make_tuple(a, b, u);
+                    fabc = std::make_tuple(fa, fb, fu);
+                    return true;
+                }
+                u = c + K * cmb;
+                fu = funPtr(u);
+            }
+            else if (u > c && u < uLim) {
+                fu = funPtr(u);
+                if (fu < fc) {
+                    b = c; c = u; u = c + K * cmb;
+                    fb = fc, fc = fu, fu = funPtr(u);
+                }
+            }
+            else if (u > uLim) {
+                u = uLim;
+                fu = funPtr(u);
+            }
+            else {
+                u = c + K * cmb;
+                fu = funPtr(u);
+            }
+            a = b; b = c; c = u;
+            fa = fb; fb = fc; fc = fu;
+        }
+        abc = std::make_tuple(a, b, c);
+        fabc = std::make_tuple(fa, fb, fc);
+        return true;
+    }
+    else {
+        c = b; fc = fb;
+        b = a; fb = fa;
+        a = b - K * (c - b);
+        fa = funPtr(a);
+        /// go to the left
+        while (fa < fb) {
+            /// parabolic interpolation
+            double u = parabolicMinimum(a, b, c, fa, fb, fc);
+            double bma = b - a;
+            double fu, uLim = a - L * bma;
+            if (u < b && u > a) {
+                fu = funPtr(u);
+                if (fu < fa) {
+                    abc = std::make_tuple(a, u, b);
+                    fabc = std::make_tuple(fa, fu, fb);
+                    return true;
+                }
+                if (fu > fb) {
+                    abc = std::make_tuple(u, b, c);
+                    fabc = std::make_tuple(fu, fb, fc);
+                    return true;
+                }
+                u = a - K * bma;
+                fu = funPtr(u);
+            }
+            else if (u < a && u > uLim) {
+                fu = funPtr(u);
+                if (fu < fa) {
+                    b = a; a = u; u = a - K * bma;
+                    fb = fa, fa = fu, fu = funPtr(u);
+                }
+            }
+            else if (u < uLim) {
+                u = uLim;
+                fu = funPtr(u);
+            }
+            else {
+                u = a - K * bma;
+                fu = funPtr(u);
+            }
+            c = b; b = a; a = u;
+            fc = fb; fb = fa; fa = fu;
+        }
+        abc = std::make_tuple(a, b, c);
+        fabc = std::make_tuple(fa, fb, fc);
+        return true;
+    }
+}
+template <typename Function>
+bool findMinBrent(const Function &funPtr, const DoubleTriplet &abc, const DoubleTriplet &fabc, double &root, double epsilon)
+{
+    static constexpr double K = 0.5 * (3 - M_SQRT5);
+    auto [a, x, c] = abc;
+    double fx = std::get<1>(fabc);
+    double w = x, v = x, fw = fx, fv = fx;
+    double d = c - a, e = d;
+    double u = a - 1;
+    do {
+        double g = e;
+        e = d;
+        bool acceptParabolicU = false;
+        if (x != w && x != v && w != v &&
+            fx != fw && fx != fv && fw != fv) {
+            if (v < w) {
+                if (x < v)
+                    u = parabolicMinimum(x, v, w, fx, fv, fw);
+                else if (x < w)
+                    u = parabolicMinimum(v, x, w, fv, fx, fw);
+                else
+                    u = parabolicMinimum(v, w, x, fv, fw, fx);
+            }
+            else {
+                if (x < w)
+                    u = parabolicMinimum(x, w, v, fx, fv, fw);
+                else if (x < v)
+                    u = parabolicMinimum(w, x, v, fw, fx, fv);
+                else
+                    u = parabolicMinimum(w, v, x, fw, fv, fx);
+            }
+            double absumx = std::fabs(u - x);
+            if (u >= a + epsilon && u <= c - epsilon && absumx < 0.5 * g) {
+                acceptParabolicU = true; /// accept u
+                d = absumx;
+            }
+        }
+
+        if (!acceptParabolicU) {
+            /// use golden ratio instead of parabolic approximation
+            if (x < 0.5 * (c + a)) {
+                d = c - x;
+                u = x + K * d; /// golden ratio [x, c]
+            }
+            else {
+                d = x - a;
+                u = x - K * d; /// golden ratio [a, x]
+            }
+        }
+
+        if (std::fabs(u - x) < epsilon) {
+            u = x + epsilon * sign(u - x); /// setting the closest distance between u and x
+        }
+
+        double fu = funPtr(u);
+        if (fu <= fx) {
+            if (u >= x)
+                a = x;
+            else
+                c = x;
+            v = w; w = x; x = u;
+            fv = fw; fw = fx; fx = fu;
+        }
+        else {
+            if (u >= x)
+                c = u;
+            else
+                a = u;
+            if (fu <= fw || w == x) {
+                v = w; w = u;
+                fv = fw; fw = fu;
+            }
+            else if (fu <= fv || v == x || v == w) {
+                v = u;
+                fv = fu;
+            }
+        }
+    } while (0.49 * (c - a) > epsilon);
+    root = x;
+    return true;
+}
+template <typename Function>
+bool findMinBrent(const Function &funPtr, double closePoint, double &root, double epsilon)
+{
+    DoubleTriplet abc, fabc;
+    if (!findBounds(funPtr, abc, fabc, closePoint))
+        return false;
+    return findMinBrent(funPtr, abc, fabc, root, epsilon);
+}
+template <typename Function>
+bool findMinNelderMead(const Function &funPtr, std::vector<double> &point, const std::vector<double> &lowerBounds,
+                       const std::vector<double> &upperBounds, double funTol, double stepTol, int maxIter)
+{
+    size_t n = point.size();
+    if (n == 0 || lowerBounds.size() != n || upperBounds.size() != n)
+        return false;
+    auto project = [&lowerBounds, &upperBounds] (std::vector<double> &x) {
+        for (size_t i = 0; i != x.size(); ++i)
+            x[i] = std::min(std::max(x[i], lowerBounds[i]), upperBounds[i]);
+    };
+    /// values out of the domain are treated as infinite
+    auto evaluate = [&funPtr] (const std::vector<double> &x) {
+        double y = funPtr(x);
+        return std::isnan(y) ? INFINITY : y;
+    };
+
+    /// adaptive coefficients of expansion, contraction and shrinkage
+    double expansion = 1.0 + 2.0 / n;
+    double contraction = 0.75 - 0.5 / n;
+    double shrinkage = std::max(1.0 - 1.0 / n, 0.5);
+
+    /// initial simplex: steps of 5% along each coordinate, directed inside the box
+    std::vector<std::vector<double>> simplex(n + 1, point);
+    project(simplex[0]);
+    for (size_t i = 0; i != n; ++i) {
+        std::vector<double> &vertex = simplex[i + 1];
+        double step = (vertex[i] == 0.0) ? 0.00025 : 0.05 * std::fabs(vertex[i]);
+        vertex[i] += step;
+        if (vertex[i] > upperBounds[i])
+            vertex[i] -= 2 * step;
+        project(vertex);
+    }
+    std::vector<double> values(n + 1);
+    for (size_t i = 0; i <= n; ++i)
+        values[i] = evaluate(simplex[i]);
+
+    std::vector<size_t> order(n + 1);
+    std::vector<double> centroid(n), reflected(n), trial(n);
+    /// trial point centroid + t * (centroid - worst)
+    auto move = [&centroid, &project, n] (std::vector<double> &result, double t, const std::vector<double> &worst) {
+        for (size_t j = 0; j != n; ++j)
+            result[j] = centroid[j] + t * (centroid[j] - worst[j]);
+        project(result);
+    };
+    for (int iter = 0; iter < maxIter; ++iter) {
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&values] (size_t a, size_t b) { return values[a] < values[b]; });
+        size_t best = order[0], worst = order[n], secondWorst = order[n - 1];
+
+        /// check convergence by spread of function values and size of simplex
+        double fBest = values[best];
+        double size = 0.0;
+        for (size_t i = 1; i <= n; ++i) {
+            for (size_t j = 0; j != n; ++j) {
+                double distance = std::fabs(simplex[order[i]][j] - simplex[best][j]) / (1.0 + std::fabs(simplex[best][j]));
+                size = std::max(size, distance);
+            }
+        }
+        if (values[worst] - fBest <= funTol * (1.0 + std::fabs(fBest)) && size <= stepTol) {
+            point = simplex[best];
+            return true;
+        }
+
+        std::fill(centroid.begin(), centroid.end(), 0.0);
+        for (size_t i = 0; i != n; ++i) {
+            for (size_t j = 0; j != n; ++j)
+                centroid[j] += simplex[order[i]][j];
+        }
+        for (size_t j = 0; j != n; ++j)
+            centroid[j] /= n;
+
+        move(reflected, 1.0, simplex[worst]);
+        double fReflected = evaluate(reflected);
+        if (fReflected < fBest) {
+            move(trial, expansion, simplex[worst]);
+            double fExpanded = evaluate(trial);
+            if (fExpanded < fReflected) {
+                simplex[worst] = trial;
+                values[worst] = fExpanded;
+            }
+            else {
+                simplex[worst] = reflected;
+                values[worst] = fReflected;
+            }
+        }
+        else if (fReflected < values[secondWorst]) {
+            simplex[worst] = reflected;
+            values[worst] = fReflected;
+        }
+        else {
+            /// outside contraction if reflected point is better than the worst one, inside otherwise
+            bool outside = fReflected < values[worst];
+            move(trial, outside ? contraction : -contraction, simplex[worst]);
+            double fContracted = evaluate(trial);
+            if (outside ? fContracted <= fReflected : fContracted < values[worst]) {
+                simplex[worst] = trial;
+                values[worst] = fContracted;
+            }
+            else {
+                for (size_t i = 1; i <= n; ++i) {
+                    std::vector<double> &vertex = simplex[order[i]];
+                    for (size_t j = 0; j != n; ++j)
+                        vertex[j] = simplex[best][j] + shrinkage * (vertex[j] - simplex[best][j]);
+                    values[order[i]] = evaluate(vertex);
+                }
+            }
+        }
+    }
+    point = simplex[std::min_element(values.begin(), values.end()) - values.begin()];
+    return false;
+}
+template <typename Function>
+bool findMinLBFGSB(const Function &funPtr, std::vector<double> &point, const std::vector<double> &lowerBounds,
+                   const std::vector<double> &upperBounds, double gradTol, double funTol, int maxIter, int memory)
+{
+    static constexpr double ARMIJO_CONSTANT = 1e-4;
+    static constexpr int MAX_BACKTRACKING = 50;
+    size_t n = point.size();
+    if (n == 0 || lowerBounds.size() != n || upperBounds.size() != n || memory < 1)
+        return false;
+    std::vector<double> x(n), xNew(n), d(n);
+    for (size_t i = 0; i != n; ++i)
+        x[i] = std::min(std::max(point[i], lowerBounds[i]), upperBounds[i]);
+    std::pair<double, std::vector<double>> fg = funPtr(x);
+    double f = fg.first;
+    std::vector<double> g = std::move(fg.second);
+    if (!std::isfinite(f) || g.size() != n)
+        return false;
+
+    /// corrections s = x_{k+1} - x_k and y = g_{k+1} - g_k
+    std::vector<std::vector<double>> S, Y;
+    std::vector<char> isFree(n);
+    std::vector<double> alpha(memory), rho(memory);
+    /// dot product in the space of free coordinates
+    auto dot = [&isFree, n] (const std::vector<double> &a, const std::vector<double> &b) {
+        double sum = 0.0;
+        for (size_t i = 0; i != n; ++i) {
+            if (isFree[i])
+                sum += a[i] * b[i];
+        }
+        return sum;
+    };
+    for (int iter = 0; iter < maxIter; ++iter) {
+        /// coordinates, which stay on their bounds when moving along antigradient, are fixed
+        double projGradNorm = 0.0;
+        for (size_t i = 0; i != n; ++i) {
+            isFree[i] = !((x[i] <= lowerBounds[i] && g[i] > 0) || (x[i] >= upperBounds[i] && g[i] < 0));
+            if (isFree[i])
+                projGradNorm = std::max(projGradNorm, std::fabs(g[i]));
+        }
+        if (projGradNorm <= gradTol * std::max(1.0, std::fabs(f))) {
+            point = x;
+            return true;
+        }
+
+        /// two-loop recursion
+        for (size_t i = 0; i != n; ++i)
+            d[i] = isFree[i] ? g[i] : 0.0;
+        int k = S.size();
+        double gamma = 1.0;
+        for (int j = k - 1; j >= 0; --j) {
+            double sy = dot(S[j], Y[j]);
+            rho[j] = (sy > 0) ? 1.0 / sy : 0.0;
+            alpha[j] = rho[j] * dot(S[j], d);
+            for (size_t i = 0; i != n; ++i)
+                d[i] -= alpha[j] * Y[j][i];
+            if (j == k - 1 && sy > 0)
+                gamma = sy / dot(Y[j], Y[j]);
+        }
+        for (size_t i = 0; i != n; ++i)
+            d[i] = isFree[i] ? gamma * d[i] : 0.0;
+        for (int j = 0; j != k; ++j) {
+            double beta = rho[j] * dot(Y[j], d);
+            for (size_t i = 0; i != n; ++i)
+                d[i] += (alpha[j] - beta) * S[j][i];
+        }
+        double slope = 0.0;
+        for (size_t i = 0; i != n; ++i) {
+            d[i] = isFree[i] ? -d[i] : 0.0;
+            slope += g[i] * d[i];
+        }
+        if (!(slope < 0)) {
+            /// restart from the steepest descent
+            S.clear();
+            Y.clear();
+            for (size_t i = 0; i != n; ++i)
+                d[i] = isFree[i] ? -g[i] : 0.0;
+        }
+
+        /// projected backtracking, the first step is short as the scale is unknown
+        double t = S.empty() ? std::min(1.0, 1.0 / projGradNorm) : 1.0;
+        bool accepted = false;
+        for (int j = 0; j != MAX_BACKTRACKING && !accepted; ++j, t *= 0.5) {
+            double decrease = 0.0;
+            for (size_t i = 0; i != n; ++i) {
+                xNew[i] = std::min(std::max(x[i] + t * d[i], lowerBounds[i]), upperBounds[i]);
+                decrease += g[i] * (xNew[i] - x[i]);
+            }
+            fg = funPtr(xNew);
+            accepted = fg.first <= f + ARMIJO_CONSTANT * decrease && fg.second.size() == n;
+        }
+        if (!accepted) {
+            point = x;
+            return false;
+        }
+
+        std::vector<double> s(n), y(n);
+        for (size_t i = 0; i != n; ++i) {
+            s[i] = xNew[i] - x[i];
+            y[i] = fg.second[i] - g[i];
+        }
+        double fOld = f;
+        x.swap(xNew);
+        f = fg.first;
+        g = std::move(fg.second);
+        /// curvature condition keeps approximation of hessian positive definite
+        double sy = 0.0, yy = 0.0;
+        for (size_t i = 0; i != n; ++i) {
+            sy += s[i] * y[i];
+            yy += y[i] * y[i];
+        }
+        if (sy > 1e-10 * yy) {
+            if (static_cast<int>(S.size()) == memory) {
+                S.erase(S.begin());
+                Y.erase(Y.begin());
+            }
+            S.push_back(std::move(s));
+            Y.push_back(std::move(y));
+        }
+        if (fOld - f <= funTol * std::max({std::fabs(fOld), std::fabs(f), 1.0})) {
+            point = x;
+            return true;
+        }
+    }
+    point = x;
+    return false;
+}
+template <typename Function>
+double integralGaussKronrod(const Function &funPtr, double a, double b, double epsilon, int maxIntervals)
+{
+    if (a > b)
+        return -integralGaussKronrod(funPtr, b, a, epsilon, maxIntervals);
+    if (a == b)
+        return 0.0;
+
+    /// abscissae and weights of 15-point Kronrod rule, Gauss nodes have odd indices
+    static constexpr double XGK[8] = {
+        0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+        0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+        0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+        0.207784955007898467600689403773245, 0.0 };
+    static constexpr double WGK[8] = {
+        0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+        0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+        0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+        0.204432940075298892414161999234649, 0.209482141084727828012999174891714 };
+    static constexpr double WG[4] = {
+        0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+        0.381830050505118944950369775488975, 0.417959183673469387755102040816327 };
+
+    struct Interval {
+        double a, b, value, error;
+        bool operator<(const Interval &other) const { return error < other.error; }
+    };
+
+    auto rule = [&funPtr] (double left, double right) {
+        double center = 0.5 * (left + right), halfLength = 0.5 * (right - left);
+        /// evaluate integrand in all nodes at once
+        double y[15];
+        for (int i = 0; i != 7; ++i) {
+            double dx = halfLength * XGK[i];
+            y[2 * i] = funPtr(center - dx);
+            y[2 * i + 1] = funPtr(center + dx);
+        }
+        y[14] = funPtr(center);
+        /// nodes might hit integrable singularity at the boundary due to rounding
+        for (double & var : y) {
+            if (!std::isfinite(var))
+                var = 0.0;
+        }
+        double kronrod = WGK[7] * y[14], gauss = WG[3] * y[14];
+        for (int i = 0; i != 7; ++i) {
+            double sum = y[2 * i] + y[2 * i + 1];
+            kronrod += WGK[i] * sum;
+            if (i & 1)
+                gauss += WG[i >> 1] * sum;
+        }
+        return Interval{left, right, kronrod * halfLength, std::fabs((kronrod - gauss) * halfLength)};
+    };
+
+    std::vector<Interval> heap;
+    heap.reserve(maxIntervals + 1);
+    heap.push_back(rule(a, b));
+    double value = heap[0].value, error = heap[0].error;
+    while (error > std::max(epsilon, epsilon * std::fabs(value)) && (int)heap.size() < maxIntervals) {
+        std::pop_heap(heap.begin(), heap.end());
+        Interval worst = heap.back();
+        heap.pop_back();
+        double center = 0.5 * (worst.a + worst.b);
+        if (center <= worst.a || center >= worst.b) {
+            /// interval cannot be bisected anymore
+            heap.push_back(worst);
+            break;
+        }
+        Interval left = rule(worst.a, center), right = rule(center, worst.b);
+        value += left.value + right.value - worst.value;
+        error += left.error + right.error - worst.error;
+        heap.push_back(left);
+        std::push_heap(heap.begin(), heap.end());
+        heap.push_back(right);
+        std::push_heap(heap.begin(), heap.end());
+    }
+    /// sum up again to get rid of accumulated rounding errors
+    value = 0.0;
+    for (const Interval &interval : heap)
+        value += interval.value;
+    return value;
+}
+
+template <typename Function>
+double integralTanhSinh(const Function &funPtr, double a, double b, double epsilon)
+{
+    if (a > b)
+        return -integralTanhSinh(funPtr, b, a, epsilon);
+    if (a == b)
+        return 0.0;
+
+    const std::vector<std::vector<DoublePair>> *nodes = nullptr;
+    bool isLeftBoundFinite = std::isfinite(a), isRightBoundFinite = std::isfinite(b);
+    double halfLength = 0.5 * (b - a);
+
+    /// weighted sum of integrand in two nodes, symmetric in t
+    auto term = [&] (const DoublePair &node) {
+        double x = node.first, w = node.second, y;
+        if (isLeftBoundFinite && isRightBoundFinite) {
+            double dx = halfLength * x;
+            y = w * halfLength * (funPtr(a + dx) + funPtr(b - dx));
+        }
+        else if (isLeftBoundFinite)
+            y = w * (x * funPtr(a + x) + funPtr(a + 1.0 / x) / x);
+        else if (isRightBoundFinite)
+            y = w * (x * funPtr(b - x) + funPtr(b - 1.0 / x) / x);
+        else
+            y = w * (funPtr(x) + funPtr(-x));
+        return std::isfinite(y) ? y : 0.0;
+    };
+
+    if (isLeftBoundFinite && isRightBoundFinite)
+        nodes = &tanhSinhNodes();
+    else if (isLeftBoundFinite || isRightBoundFinite)
+        nodes = &expSinhNodes();
+    else
+        nodes = &sinhSinhNodes();
+
+    double h = 1.0, value = 0.0;
+    for (const DoublePair &node : (*nodes)[0])
+        value += term(node);
+    for (size_t level = 1; level != nodes->size(); ++level) {
+        h *= 0.5;
+        double sum = 0.0;
+        for (const DoublePair &node : (*nodes)[level])
+            sum += term(node);
+        double newValue = 0.5 * value + h * sum;
+        /// error decreases quadratically, hence the estimate is pessimistic
+        bool converged = std::fabs(newValue - value) <= std::max(epsilon, epsilon * std::fabs(newValue));
+        value = newValue;
+        if (converged && level > 2)
+            break;
+    }
+    return value;
+}
+
 }
 
 #endif // NUMERICMATH
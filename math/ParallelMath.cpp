@@ -0,0 +1,54 @@
+#include "ParallelMath.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RandMath
+{
+
+size_t numberOfThreads(size_t tasks)
+{
+    size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::max<size_t>(std::min(hardwareThreads, tasks), 1);
+}
+
+void parallelFor(size_t tasks, size_t threads, const std::function<void (size_t, size_t)> &task)
+{
+    threads = std::max<size_t>(std::min(threads, tasks), 1);
+    std::atomic<size_t> next(0);
+    std::exception_ptr error = nullptr;
+    std::mutex errorMutex;
+    auto worker = [tasks, &task, &next, &error, &errorMutex] (size_t thread) {
+        for (size_t index = next++; index < tasks; index = next++) {
+            try {
+                task(thread, index);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+                next = tasks;
+                return;
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t thread = 1; thread < threads; ++thread)
+        pool.emplace_back(worker, thread);
+    worker(0);
+    for (std::thread &thread : pool)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void parallelForChunks(size_t chunks, const std::function<void (size_t)> &task)
+{
+    size_t threads = (chunks < MIN_CHUNKS_FOR_THREADS) ? 1 : numberOfThreads(chunks);
+    parallelFor(chunks, threads, [&task] (size_t, size_t chunk) { task(chunk); });
+}
+
+}
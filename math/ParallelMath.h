@@ -0,0 +1,54 @@
+#ifndef PARALLELMATH_H
+#define PARALLELMATH_H
+
+#include <cstddef>
+#include <functional>
+
+/// Processing of large samples by several threads
+
+namespace RandMath
+{
+
+/// number of elements in chunks, processed by separate threads
+constexpr size_t CHUNK_SIZE = 1 << 16;
+/// minimal number of chunks to run threads
+constexpr size_t MIN_CHUNKS_FOR_THREADS = 16;
+
+/**
+ * @fn numberOfChunks
+ * @param size number of elements
+ * @return number of chunks of CHUNK_SIZE elements, covering all of them
+ */
+inline size_t numberOfChunks(size_t size) { return (size + CHUNK_SIZE - 1) / CHUNK_SIZE; }
+
+/**
+ * @fn numberOfThreads
+ * @param tasks number of independent tasks
+ * @return number of hardware threads, but not more than the number of tasks
+ */
+size_t numberOfThreads(size_t tasks);
+
+/**
+ * @fn parallelFor
+ * Run task for each index in [0, tasks) by the given number of threads, including the current one.
+ * Tasks are taken dynamically, as their duration may vary. Each task should write only its own output,
+ * which is merged by the caller in order of indices, so that the result doesn't depend on the number of threads.
+ * The first exception, thrown by any task, stops taking new tasks and is rethrown after all threads are finished
+ * @param tasks number of tasks
+ * @param threads number of threads
+ * @param task function of index of thread (in [0, threads)) and index of task
+ */
+void parallelFor(size_t tasks, size_t threads, const std::function<void (size_t, size_t)> &task);
+
+/**
+ * @fn parallelForChunks
+ * Run task for each chunk by several threads if there are at least MIN_CHUNKS_FOR_THREADS chunks
+ * and in the current thread otherwise
+ * @param chunks number of chunks
+ * @param task function of index of chunk
+ */
+void parallelForChunks(size_t chunks, const std::function<void (size_t)> &task);
+
+}
+
+#endif // PARALLELMATH_H
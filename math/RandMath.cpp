@@ -193,9 +193,42 @@ double harmonicNumber(double exponent, int number)
         return M_EULER + digamma(number + 1);
     if (exponent == 2)
         return M_PI_SQ / 6.0 - trigamma(number + 1);
+    /// for small number we sum directly
+    static constexpr int DIRECT_SUM_LIMIT = 64;
     double res = 1.0;
-    for (int i = 2; i <= number; ++i)
+    if (number <= DIRECT_SUM_LIMIT) {
+        for (int i = 2; i <= number; ++i)
+            res += std::pow(i, -exponent);
+        return res;
+    }
+    /// otherwise we sum first m - 1 terms directly
+    /// and use Euler-Maclaurin formula for the rest of them
+    static constexpr int m = 16;
+    for (int i = 2; i < m; ++i)
         res += std::pow(i, -exponent);
+    double n = number, s = exponent;
+    double logM = std::log(m), logN = std::log(n);
+    double powM = std::exp(-s * logM), powN = std::exp(-s * logN);
+    /// integral of x^(-s) from m to n: m^(1-s) (exp(y) - 1) / (1 - s) with y = (1 - s) log(n / m),
+    /// computed stably for s close to 1
+    double logRatio = logN - logM;
+    double y = (1.0 - s) * logRatio;
+    double expm1y = (std::fabs(y) > 1e-8) ? std::expm1(y) / y : 1.0 + 0.5 * y * (1.0 + y / 3.0);
+    double integral = m * powM * logRatio * expm1y;
+    res += integral + 0.5 * (powM + powN);
+    /// corrections with Bernoulli numbers B_2k / (2k)!
+    static constexpr double B[] = {1.0 / 12, -1.0 / 720, 1.0 / 30240, -1.0 / 1209600};
+    /// (2k-1)-th derivative of x^(-s) is -s(s+1)...(s+2k-2) x^(-s-2k+1)
+    double coef = -s;
+    double derM = powM / m, derN = powN / n;
+    double mSqInv = 1.0 / (m * m), nSqInv = 1.0 / (n * n);
+    for (double b : B) {
+        res += b * coef * (derN - derM);
+        coef *= (s + 1) * (s + 2);
+        s += 2;
+        derM *= mSqInv;
+        derN *= nSqInv;
+    }
     return res;
 }
 
@@ -330,7 +363,7 @@ double MarcumPSeries(double mu, double x, double y, double logX, double logY)
     /// to find first negleted term
     double root = std::max(0.5 * (mu * mu + 4 * x * y - mu), 1.0);
     double logXY = logX + logY;
-    if (!RandMath::findRoot([C, mu, logXY] (double n)
+    if (!RandMath::findRootNewtonSecondOrder([C, mu, logXY] (double n)
     {
         double npmu = n + mu;
         double logn = std::log(n), lognpmu = std::log(npmu);
@@ -445,7 +478,7 @@ double MarcumPForMuLessThanOne(double mu, double x, double y, double logX, doubl
     I = std::exp(I) / mu;
 
     double mum1 = mu - 1.0;
-    I += RandMath::integral([x, log2x, mum1, aux] (double t)
+    I += RandMath::integralAdaptiveSimpson([x, log2x, mum1, aux] (double t)
     {
         if (t <= 0)
             return 0.0;
@@ -491,8 +524,8 @@ double MarcumQIntergralRepresentation(double mu, double x, double y, double sqrt
     double yPrime = y / mu;
     double s0 = 0.5 * (1.0 + sqrt1pXiSq) / yPrime;
     double phi = x / s0 + y * s0 - std::log(s0) * mu;
-    std::function<double (double)> integrandPtr = std::bind(&MarcumQIntegrand, std::placeholders::_1, xi, sqrt1pXiSq, mu, yPrime);
-    double integral = RandMath::integral(integrandPtr, -M_PI, M_PI);
+    auto integrandPtr = [xi, sqrt1pXiSq, mu, yPrime] (double theta) { return MarcumQIntegrand(theta, xi, sqrt1pXiSq, mu, yPrime); };
+    double integral = RandMath::integralAdaptiveSimpson(integrandPtr, -M_PI, M_PI);
     return 0.5 * std::exp(-x - y + phi) / M_PI * integral;
 }
 
@@ -523,7 +556,7 @@ double MarcumP(double mu, double x, double y, double sqrtX, double sqrtY, double
     // TODO: implement the rest techniques
 
     double mum1 = mu - 1;
-    return RandMath::integral([mum1, logX, x](double t) {
+    return RandMath::integralAdaptiveSimpson([mum1, logX, x](double t) {
         if (t < 0.0)
             return 0.0;
         if (t == 0.0)
@@ -12,7 +12,6 @@
 #include "Constants.h"
 #include "GammaMath.h"
 #include "BetaMath.h"
-#include "NumericMath.h"
 
 namespace RandMath
 {
@@ -175,4 +174,6 @@ double MarcumQ(double mu, double x, double y, double sqrtX, double sqrtY, double
 double MarcumQ(double mu, double x, double y);
 }
 
+#include "NumericMath.h"
+
 #endif // RANDMATH_H